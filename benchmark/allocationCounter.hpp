@@ -0,0 +1,23 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Get the number of calls to the global operator new since the benchmarks started.
+ * @return The number of heap allocations made by the process, from every thread.
+ *
+ * The benchmark executable replaces the global operator new to count its calls, so a benchmark can report the
+ * allocations of the code it measures by reading the count before and after it.
+ */
+std::uint64_t heapAllocations();
+
+#endif // ALLOCATION_COUNTER_HPP
@@ -0,0 +1,127 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "articleIndex.hpp"
+#include "articleRegular.hpp"
+#include "trackFactory.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::shared_ptr<Article>> makeArticles(size_t amount)
+{
+    std::vector<std::shared_ptr<Article>> articles;
+    articles.reserve(amount);
+    for (size_t i = 0; i < amount; ++i)
+    {
+        nlohmann::json articleJson = {{"articleTitle", "Submitted article number " + std::to_string(i)},
+                                      {"attachedFileUrl", "https://bit.ly/example"},
+                                      {"abstract", "Detailed exploration of modern C++ features."}};
+        articles.push_back(std::make_shared<ArticleRegular>(articleJson));
+    }
+    return articles;
+}
+} // namespace
+
+// Update lookup as done before the title index: a linear scan comparing titles
+static void BM_LinearTitleUpdate(benchmark::State& state)
+{
+    const auto articles = makeArticles(state.range(0));
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        const auto& targetTitle = articles[next]->articleName();
+        auto it = std::find_if(articles.begin(), articles.end(), [&targetTitle](const std::shared_ptr<Article>& a) {
+            return a->articleName() == targetTitle;
+        });
+        (*it)->updateFields(articles[next]);
+        next = (next + 7919) % articles.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LinearTitleUpdate)->Arg(10'000)->Arg(100'000);
+
+// Update lookup through the title index
+static void BM_IndexedTitleUpdate(benchmark::State& state)
+{
+    const auto articles = makeArticles(state.range(0));
+    ArticleIndex index;
+    for (const auto& article : articles)
+    {
+        index.insert(article);
+    }
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        index.find(articles[next]->articleName())->updateFields(articles[next]);
+        next = (next + 7919) % articles.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IndexedTitleUpdate)->Arg(10'000)->Arg(100'000);
+
+// Full submission burst through a track: create, update and delete every article
+static void BM_TrackSubmissionBurst(benchmark::State& state)
+{
+    const auto articles = makeArticles(state.range(0));
+    const auto trackJson = R"( { "trackType": "regular", "trackTopic": "Benchmark" } )"_json;
+    for (auto _ : state)
+    {
+        auto track = TrackFactory::createTrack(trackJson);
+        for (const auto& article : articles)
+        {
+            track->handleTrackArticle(article, OperationType::Create);
+        }
+        for (const auto& article : articles)
+        {
+            track->handleTrackArticle(article, OperationType::Update);
+        }
+        for (const auto& article : articles)
+        {
+            track->handleTrackArticle(article, OperationType::Delete);
+        }
+        benchmark::DoNotOptimize(track->amountArticles());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 3);
+}
+BENCHMARK(BM_TrackSubmissionBurst)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+// The submissions of an import job at the deadline, one article at a time
+static void BM_TrackImportSingle(benchmark::State& state)
+{
+    const auto articles = makeArticles(state.range(0));
+    const auto trackJson = R"( { "trackType": "regular", "trackTopic": "Benchmark" } )"_json;
+    for (auto _ : state)
+    {
+        auto track = TrackFactory::createTrack(trackJson);
+        for (const auto& article : articles)
+        {
+            track->handleTrackArticle(article, OperationType::Create);
+        }
+        benchmark::DoNotOptimize(track->amountArticles());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TrackImportSingle)->Arg(50'000)->Unit(benchmark::kMillisecond);
+
+// The same submissions handed to the track as one batch
+static void BM_TrackImportBatch(benchmark::State& state)
+{
+    const auto articles = makeArticles(state.range(0));
+    const auto trackJson = R"( { "trackType": "regular", "trackTopic": "Benchmark" } )"_json;
+    for (auto _ : state)
+    {
+        auto track = TrackFactory::createTrack(trackJson);
+        benchmark::DoNotOptimize(track->handleTrackArticles(articles, OperationType::Create).data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TrackImportBatch)->Arg(50'000)->Unit(benchmark::kMillisecond);
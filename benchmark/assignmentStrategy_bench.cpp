@@ -0,0 +1,182 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "allocationCounter.hpp"
+#include "articleRegular.hpp"
+#include "assignmentStrategyOptimal.hpp"
+#include "assignmentStrategyRoundRobin.hpp"
+#include "bidMatrix.hpp"
+#include "conflictIndex.hpp"
+#include "reviewer.hpp"
+#include <benchmark/benchmark.h>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+BidMatrix makeBids(size_t reviewers, size_t articles)
+{
+    // Each reviewer cares about a few topics, so interest is clustered instead of uniform
+    constexpr size_t topics = 50;
+    std::mt19937 generator(2026);
+    std::uniform_int_distribution<size_t> topic(0, topics - 1);
+    std::uniform_int_distribution<int> noise(0, 9);
+
+    std::vector<size_t> articleTopic(articles);
+    for (auto& value : articleTopic)
+    {
+        value = topic(generator);
+    }
+
+    BidMatrix bids;
+    bids.reset(reviewers, articles);
+    for (size_t reviewer = 0; reviewer < reviewers; ++reviewer)
+    {
+        const auto first = topic(generator);
+        const auto second = topic(generator);
+        for (size_t article = 0; article < articles; ++article)
+        {
+            const auto roll = noise(generator);
+            if (articleTopic[article] == first || articleTopic[article] == second)
+            {
+                bids.set(reviewer, article, roll < 7 ? BiddingInterest::Interested : BiddingInterest::Maybe);
+            }
+            else if (roll == 0)
+            {
+                bids.set(reviewer, article, BiddingInterest::Maybe);
+            }
+            else if (roll < 4)
+            {
+                bids.set(reviewer, article, BiddingInterest::NotInterested);
+            }
+        }
+    }
+    return bids;
+}
+
+/**
+ * @brief Create a user of one of the affiliations.
+ */
+std::shared_ptr<User> makeUser(const std::string& name, size_t affiliation, bool reviewer)
+{
+    const nlohmann::json userJson = {{"name", name},
+                                     {"affiliation", "Affiliation " + std::to_string(affiliation)},
+                                     {"email", "user@tyh.com"},
+                                     {"password", "1234"},
+                                     {"isChair", false},
+                                     {"isAuthor", !reviewer},
+                                     {"isReviewer", reviewer}};
+    if (reviewer)
+    {
+        return std::make_shared<Reviewer>(userJson);
+    }
+    return std::make_shared<User>(userJson);
+}
+
+void reportAffinity(benchmark::State& state, const BidMatrix& bids,
+                    const std::pmr::vector<ReviewAssignment>& assignments)
+{
+    double total = 0;
+    for (const auto& assignment : assignments)
+    {
+        total += AssignmentStrategyOptimal::affinity(bids.at(assignment.reviewer, assignment.article));
+    }
+    state.counters["reviews"] = static_cast<double>(assignments.size());
+    state.counters["affinity"] = assignments.empty() ? 0 : total / static_cast<double>(assignments.size());
+}
+} // namespace
+
+// Round-robin dealing of the articles ranked by demand
+static void BM_RoundRobinAssignment(benchmark::State& state)
+{
+    const auto bids = makeBids(state.range(0), state.range(1));
+    AssignmentStrategyRoundRobin strategy(3);
+    const ConflictMask noConflicts;
+    std::pmr::vector<ReviewAssignment> assignments;
+    for (auto _ : state)
+    {
+        strategy.assign(assignments, bids, noConflicts, {});
+        benchmark::DoNotOptimize(assignments.data());
+    }
+    reportAffinity(state, bids, assignments);
+}
+BENCHMARK(BM_RoundRobinAssignment)->Args({300, 2'000})->Args({3'000, 20'000})->Unit(benchmark::kMillisecond);
+
+// Min-cost flow assignment maximizing the total affinity, its network living in an arena as in the review phase
+static void BM_OptimalAssignment(benchmark::State& state)
+{
+    const auto bids = makeBids(state.range(0), state.range(1));
+    AssignmentStrategyOptimal strategy(3);
+    const ConflictMask noConflicts;
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<ReviewAssignment> assignments(&arena);
+    const auto before = heapAllocations();
+    for (auto _ : state)
+    {
+        strategy.assign(assignments, bids, noConflicts, {});
+        benchmark::DoNotOptimize(assignments.data());
+    }
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(heapAllocations() - before), benchmark::Counter::kAvgIterations);
+    reportAffinity(state, bids, assignments);
+}
+BENCHMARK(BM_OptimalAssignment)
+    ->Args({300, 2'000})
+    ->Args({3'000, 20'000})
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+
+// Round-robin dealing of the articles, passing over the colleagues of their authors
+static void BM_RoundRobinAssignmentWithConflicts(benchmark::State& state)
+{
+    constexpr size_t affiliations = 300;
+    constexpr size_t authorsPerArticle = 3;
+    const auto bids = makeBids(state.range(0), state.range(1));
+
+    // Reviewers and authors spread over the affiliations, every article written by registered authors
+    ConflictIndex index;
+    std::vector<std::shared_ptr<User>> reviewers;
+    for (size_t reviewer = 0; reviewer < bids.reviewers(); ++reviewer)
+    {
+        reviewers.push_back(makeUser("Reviewer " + std::to_string(reviewer), reviewer % affiliations, true));
+        index.addUser(*reviewers.back());
+    }
+    std::mt19937 generator(2026);
+    std::uniform_int_distribution<size_t> author(0, bids.articles() - 1);
+    std::vector<std::shared_ptr<Article>> articles;
+    for (size_t article = 0; article < bids.articles(); ++article)
+    {
+        index.addUser(*makeUser("Author " + std::to_string(article), (article * 7) % affiliations, false));
+        std::vector<std::string> names;
+        for (size_t name = 0; name < authorsPerArticle; ++name)
+        {
+            names.push_back("Author " + std::to_string(author(generator)));
+        }
+        articles.push_back(std::make_shared<ArticleRegular>("Article " + std::to_string(article),
+                                                            "https://bit.ly/example", names, "Abstract."));
+    }
+
+    AssignmentStrategyRoundRobin strategy(3);
+    ConflictMask mask;
+    std::pmr::vector<ReviewAssignment> assignments;
+    size_t masked = 0;
+    for (auto _ : state)
+    {
+        masked = index.mask(mask, articles, reviewers);
+        strategy.assign(assignments, bids, mask, {});
+        benchmark::DoNotOptimize(assignments.data());
+    }
+    reportAffinity(state, bids, assignments);
+    state.counters["masked"] = static_cast<double>(masked);
+}
+BENCHMARK(BM_RoundRobinAssignmentWithConflicts)
+    ->Args({300, 2'000})
+    ->Args({3'000, 20'000})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,123 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "articleFactory.hpp"
+#include "conferenceGenerator.hpp"
+#include "conferenceLoader.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace
+{
+/**
+ * @brief Write a synthetic conference document once and return its path.
+ * @return The path of the document, in the temporary directory.
+ *
+ * The conference has 40 tracks of 2,000 articles, each reviewed by 50 of 2,000 reviewers.
+ */
+const std::filesystem::path& conferenceDocument()
+{
+    static const auto path = [] {
+        auto file = std::filesystem::temp_directory_path() / "comfy_chair_conference_bench.json";
+        std::ofstream output(file, std::ios::binary);
+        ConferenceGenerator({.tracks = 40,
+                             .articles = 2'000,
+                             .reviewers = 2'000,
+                             .reviewersPerTrack = 50,
+                             .authors = 20'000,
+                             .affiliations = 200,
+                             .seed = 2024})
+            .write(output);
+        return file;
+    }();
+    return path;
+}
+
+/**
+ * @brief Reset the peak resident set size of the process, where the kernel allows it.
+ */
+void resetPeakMemory()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+/**
+ * @brief Read the peak resident set size of the process.
+ * @return The peak resident set size in megabytes, or 0 if it is not available.
+ */
+double peakMemory()
+{
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);)
+    {
+        if (line.rfind("VmHWM:", 0) == 0)
+        {
+            return std::stod(line.substr(6)) / 1024.0;
+        }
+    }
+    return 0.0;
+}
+
+void runLoad(benchmark::State& state, const std::function<std::shared_ptr<Conference>()>& load)
+{
+    const auto size = std::filesystem::file_size(conferenceDocument());
+    double peak = 0.0;
+    std::cout.setstate(std::ios::failbit);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        resetPeakMemory();
+        state.ResumeTiming();
+
+        auto conference = load();
+        benchmark::DoNotOptimize(conference.get());
+
+        state.PauseTiming();
+        conference.reset();
+        peak = std::max(peak, peakMemory());
+        state.ResumeTiming();
+    }
+    std::cout.clear();
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+    state.counters["documentMB"] = static_cast<double>(size) / (1024.0 * 1024.0);
+    state.counters["peakRssMB"] = peak;
+}
+} // namespace
+
+// Streaming load of the conference with the SAX loader
+static void BM_ConferenceLoadStreaming(benchmark::State& state)
+{
+    runLoad(state, [] { return ConferenceLoader::load(conferenceDocument().string()); });
+}
+BENCHMARK(BM_ConferenceLoadStreaming)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Load of the same conference through a DOM, the Conference constructor and the ArticleFactory
+static void BM_ConferenceLoadDom(benchmark::State& state)
+{
+    runLoad(state, [] {
+        std::ifstream input(conferenceDocument(), std::ios::binary);
+        const auto document = nlohmann::json::parse(input);
+        auto conference = std::make_shared<Conference>(document);
+        for (size_t track = 0; track < conference->tracks().size(); ++track)
+        {
+            for (const auto& article : document.at("tracks").at(track).at("articles"))
+            {
+                conference->tracks()[track]->handleTrackArticle(ArticleFactory::createArticle(article),
+                                                                OperationType::Create);
+            }
+        }
+        return conference;
+    });
+}
+BENCHMARK(BM_ConferenceLoadDom)->Unit(benchmark::kMillisecond)->UseRealTime();
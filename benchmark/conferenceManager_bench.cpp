@@ -0,0 +1,90 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "articleRegular.hpp"
+#include "assignmentStrategyOptimal.hpp"
+#include "conferenceManager.hpp"
+#include "reviewer.hpp"
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t TRACKS = 40;    /**< Tracks of the conference. */
+constexpr size_t REVIEWERS = 40; /**< Reviewers shared by every track. */
+constexpr size_t ARTICLES = 200; /**< Articles submitted to each track. */
+
+std::shared_ptr<Conference> makeConference()
+{
+    nlohmann::json conferenceJson = {{"createdAt", "2024-07-18T00:00:00Z"}, {"tracks", nlohmann::json::array()}};
+    for (size_t track = 0; track < TRACKS; ++track)
+    {
+        conferenceJson["tracks"].push_back(
+            {{"trackType", "regular"}, {"trackTopic", "Benchmark " + std::to_string(track)}});
+    }
+    auto conference = std::make_shared<Conference>(conferenceJson);
+
+    std::vector<std::shared_ptr<Reviewer>> reviewers;
+    for (size_t reviewer = 0; reviewer < REVIEWERS; ++reviewer)
+    {
+        reviewers.push_back(std::make_shared<Reviewer>(nlohmann::json{{"name", "Reviewer " + std::to_string(reviewer)},
+                                                                      {"affiliation", "Tecnicas y herramientas"},
+                                                                      {"email", "reviewer@tyh.com"},
+                                                                      {"password", "1234"},
+                                                                      {"isChair", false},
+                                                                      {"isAuthor", false},
+                                                                      {"isReviewer", true}}));
+    }
+
+    const auto strategy = std::make_shared<AssignmentStrategyOptimal>();
+    for (const auto& track : conference->tracks())
+    {
+        track->assignmentStrategy(strategy);
+        for (const auto& reviewer : reviewers)
+        {
+            track->addReviewer(reviewer);
+        }
+        for (size_t article = 0; article < ARTICLES; ++article)
+        {
+            nlohmann::json articleJson = {{"articleTitle", "Submitted article number " + std::to_string(article)},
+                                          {"attachedFileUrl", "https://bit.ly/example"},
+                                          {"abstract", "Detailed exploration of modern C++ features."}};
+            track->handleTrackArticle(std::make_shared<ArticleRegular>(articleJson), OperationType::Create);
+        }
+    }
+    return conference;
+}
+} // namespace
+
+// Bidding and review of a 40 track conference, by number of threads
+static void BM_ConferencePhases(benchmark::State& state)
+{
+    std::optional<ConferenceManager> conferenceManager;
+    std::cout.setstate(std::ios::failbit);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        conferenceManager.emplace(makeConference(), state.range(0));
+        state.ResumeTiming();
+
+        conferenceManager->startBidding(std::chrono::system_clock::now());
+        conferenceManager->runBidding();
+        conferenceManager->startRevision(std::chrono::system_clock::now());
+        conferenceManager->runReview();
+
+        state.PauseTiming();
+        conferenceManager.reset();
+        state.ResumeTiming();
+    }
+    std::cout.clear();
+    state.SetItemsProcessed(state.iterations() * TRACKS);
+}
+BENCHMARK(BM_ConferencePhases)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,129 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conferenceLoader.hpp"
+#include "conferenceManager.hpp"
+#include "conferenceSnapshot.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace
+{
+constexpr size_t USERS = 400;      /**< Users of the generated conference. */
+constexpr size_t TRACKS = 40;      /**< Tracks of the generated conference. */
+constexpr size_t REVIEWERS = 10;   /**< Reviewers of each track. */
+constexpr size_t ARTICLES = 2'500; /**< Articles submitted to each track. */
+
+/**
+ * @brief Write a synthetic conference document once and return its path.
+ * @return The path of the document, in the temporary directory.
+ */
+const std::filesystem::path& conferenceDocument()
+{
+    static const auto path = [] {
+        auto file = std::filesystem::temp_directory_path() / "comfy_chair_snapshot_bench.json";
+        std::ofstream output(file, std::ios::binary);
+        output << R"({"createdAt": "2024-07-18T00:00:00Z", "seed": 2024, "users": [)";
+        for (size_t user = 0; user < USERS; ++user)
+        {
+            output << (user == 0 ? "" : ",") << R"({"name": "Reviewer )" << user
+                   << R"(", "affiliation": "Example University", "password": "password", "email": "reviewer)" << user
+                   << R"(@example.com", "isChair": false, "isReviewer": true, "isAuthor": false})";
+        }
+        output << R"(], "tracks": [)";
+        for (size_t track = 0; track < TRACKS; ++track)
+        {
+            output << (track == 0 ? "" : ",") << R"({"trackType": "regular", "trackTopic": "Topic )" << track
+                   << R"(", "reviewers": [)";
+            for (size_t reviewer = 0; reviewer < REVIEWERS; ++reviewer)
+            {
+                output << (reviewer == 0 ? "" : ",") << "\"Reviewer " << (track * REVIEWERS + reviewer) % USERS << '"';
+            }
+            output << R"(], "articles": [)";
+            for (size_t article = 0; article < ARTICLES; ++article)
+            {
+                output << (article == 0 ? "" : ",") << R"({"articleType": "regular", "articleTitle": "Article )"
+                       << track << '-' << article
+                       << R"(", "attachedFileUrl": "https://bit.ly/example", "authors": ["Jane Smith", "John Doe"], )"
+                       << R"("abstract": "Detailed exploration of modern C++ features."})";
+            }
+            output << "]}";
+        }
+        output << "]}";
+        return file;
+    }();
+    return path;
+}
+
+/**
+ * @brief Load the generated conference, run its bidding and review, and snapshot it once.
+ * @return The path of the snapshot, in the temporary directory.
+ */
+const std::filesystem::path& conferenceSnapshot()
+{
+    static const auto path = [] {
+        auto file = std::filesystem::temp_directory_path() / "comfy_chair_snapshot_bench.bin";
+        const auto conference = ConferenceLoader::load(conferenceDocument().string());
+        ConferenceManager conferenceManager(conference);
+        std::cout.setstate(std::ios::failbit);
+        conferenceManager.startBidding(std::chrono::system_clock::now());
+        conferenceManager.runBidding();
+        conferenceManager.startRevision(std::chrono::system_clock::now());
+        conferenceManager.runReview();
+        std::cout.clear();
+        ConferenceSnapshot::write(*conference, file.string());
+        return file;
+    }();
+    return path;
+}
+} // namespace
+
+// Writing a snapshot of the reviewed conference
+static void BM_ConferenceSnapshotWrite(benchmark::State& state)
+{
+    const auto conference = ConferenceSnapshot::load(conferenceSnapshot().string());
+    const auto path = conferenceSnapshot().string() + ".write";
+    for (auto _ : state)
+    {
+        ConferenceSnapshot::write(*conference, path);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_ConferenceSnapshotWrite)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Reopening the reviewed conference from its snapshot
+static void BM_ConferenceSnapshotLoad(benchmark::State& state)
+{
+    const auto size = std::filesystem::file_size(conferenceSnapshot());
+    for (auto _ : state)
+    {
+        auto conference = ConferenceSnapshot::load(conferenceSnapshot().string());
+        benchmark::DoNotOptimize(conference.get());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+    state.counters["snapshotMB"] = static_cast<double>(size) / (1024.0 * 1024.0);
+}
+BENCHMARK(BM_ConferenceSnapshotLoad)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Loading the same conference, before bidding, from its JSON document
+static void BM_ConferenceSnapshotJsonBaseline(benchmark::State& state)
+{
+    const auto size = std::filesystem::file_size(conferenceDocument());
+    for (auto _ : state)
+    {
+        auto conference = ConferenceLoader::load(conferenceDocument().string());
+        benchmark::DoNotOptimize(conference.get());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+    state.counters["documentMB"] = static_cast<double>(size) / (1024.0 * 1024.0);
+}
+BENCHMARK(BM_ConferenceSnapshotJsonBaseline)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,66 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "articleRegular.hpp"
+#include "mutationLog.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Durable article submissions from concurrent submitters, with and without a commit delay
+static void BM_MutationLogSubmissions(benchmark::State& state)
+{
+    const auto submitters = static_cast<size_t>(state.range(0));
+    const auto delay = std::chrono::microseconds(state.range(1));
+    constexpr size_t SUBMISSIONS = 200;
+    const auto path = (std::filesystem::temp_directory_path() / "comfy_chair_mutation_log_bench.wal").string();
+    const ArticleRegular article("Advanced C++ Techniques", "https://bit.ly/example", {"Jane Smith", "John Doe"},
+                                 "Detailed exploration of modern C++ features.");
+
+    std::uint64_t syncs = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::filesystem::remove(path);
+        auto log = std::make_shared<MutationLog>(path, delay);
+        state.ResumeTiming();
+
+        std::vector<std::thread> threads;
+        for (size_t submitter = 0; submitter < submitters; ++submitter)
+        {
+            threads.emplace_back([&log, &article] {
+                const TrackJournal journal(log, 0);
+                for (size_t submission = 0; submission < SUBMISSIONS; ++submission)
+                {
+                    journal.article(article, OperationType::Create);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        state.PauseTiming();
+        syncs += log->syncs();
+        log.reset();
+        state.ResumeTiming();
+    }
+    std::filesystem::remove(path);
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(submitters * SUBMISSIONS));
+    state.counters["recordsPerSync"] = static_cast<double>(state.iterations() * submitters * SUBMISSIONS) /
+                                       static_cast<double>(std::max<std::uint64_t>(syncs, 1));
+}
+BENCHMARK(BM_MutationLogSubmissions)
+    ->ArgsProduct({{1, 8, 64}, {0, 200}})
+    ->ArgNames({"submitters", "delayUs"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,161 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "allocationCounter.hpp"
+#include "conferenceGenerator.hpp"
+#include "reportSinkNull.hpp"
+#include "selectionStrategyFixedCut.hpp"
+#include "trackPhase.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+
+namespace
+{
+/**
+ * @brief Get the generator of the one track conference of a benchmark.
+ * @param state The benchmark, its arguments being the articles, reviewers and reviews per article.
+ * @return The generator, with as many authors as articles.
+ */
+ConferenceGenerator pipelineGenerator(const benchmark::State& state)
+{
+    return ConferenceGenerator({.tracks = 1,
+                                .articles = static_cast<std::size_t>(state.range(0)),
+                                .reviewers = static_cast<std::size_t>(state.range(1)),
+                                .reviewsPerArticle = static_cast<std::uint32_t>(state.range(2)),
+                                .authors = static_cast<std::size_t>(state.range(0))});
+}
+
+/**
+ * @brief Generate the one track conference of a benchmark, reporting to a null sink.
+ * @param state The benchmark, its arguments being the articles, reviewers and reviews per article.
+ * @param submitted Whether the articles are already submitted to the track.
+ * @return The conference.
+ */
+std::shared_ptr<Conference> quietConference(const benchmark::State& state, bool submitted)
+{
+    const auto generator = pipelineGenerator(state);
+    auto conference = generator.conference();
+    conference->reportSink(std::make_shared<ReportSinkNull>());
+    if (submitted)
+    {
+        generator.submit(*conference);
+    }
+    return conference;
+}
+
+/**
+ * @brief Register the shapes of the phase benchmarks, from a small workshop to a large track.
+ * @param benchmark The benchmark to parameterize.
+ */
+void pipelineShapes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"articles", "reviewers", "reviews"});
+    benchmark->Args({200, 40, 3})->Args({2'000, 200, 3})->Args({10'000, 500, 3});
+    benchmark->Unit(benchmark::kMicrosecond);
+}
+
+/**
+ * @brief Report the heap allocations of a benchmark, per iteration.
+ * @param state The benchmark.
+ * @param allocations The allocations made by the measured code over every iteration.
+ */
+void reportAllocations(benchmark::State& state, std::uint64_t allocations)
+{
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+// Articles submitted one at a time to a track receiving them
+static void BM_PipelineReception(benchmark::State& state)
+{
+    const auto articles = pipelineGenerator(state).articles(0);
+    std::uint64_t allocations = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const auto conference = quietConference(state, false);
+        const auto& track = conference->tracks().front();
+        state.ResumeTiming();
+
+        const auto before = heapAllocations();
+        for (const auto& article : articles)
+        {
+            track->handleTrackArticle(article, OperationType::Create);
+        }
+        allocations += heapAllocations() - before;
+    }
+    reportAllocations(state, allocations);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PipelineReception)->Apply(pipelineShapes);
+
+// Every reviewer of a track bidding on every article
+static void BM_PipelineBidding(benchmark::State& state)
+{
+    std::uint64_t allocations = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const auto conference = quietConference(state, true);
+        const auto& track = conference->tracks().front();
+        track->establishState(BiddingStateTrack{});
+        state.ResumeTiming();
+
+        const auto before = heapAllocations();
+        track->handleTrackBidding();
+        allocations += heapAllocations() - before;
+    }
+    reportAllocations(state, allocations);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(BM_PipelineBidding)->Apply(pipelineShapes);
+
+// Assignment, conflict masking and reviews of a track once the bidding is over
+static void BM_PipelineReview(benchmark::State& state)
+{
+    std::uint64_t allocations = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const auto conference = quietConference(state, true);
+        const auto& track = conference->tracks().front();
+        track->establishState(BiddingStateTrack{});
+        track->handleTrackBidding();
+        track->establishState(ReviewStateTrack{});
+        state.ResumeTiming();
+
+        const auto before = heapAllocations();
+        track->handleTrackReview();
+        allocations += heapAllocations() - before;
+    }
+    reportAllocations(state, allocations);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(2));
+}
+BENCHMARK(BM_PipelineReview)->Apply(pipelineShapes);
+
+// Selection of the best tenth of a reviewed track
+static void BM_PipelineSelection(benchmark::State& state)
+{
+    const auto conference = quietConference(state, true);
+    const auto& track = conference->tracks().front();
+    track->selectionStrategy(std::make_shared<SelectionStrategyFixedCut>());
+    track->establishState(BiddingStateTrack{});
+    track->handleTrackBidding();
+    track->establishState(ReviewStateTrack{});
+    track->handleTrackReview();
+    track->establishState(SelectionStateTrack{});
+    const auto before = heapAllocations();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(track->handleTrackSelection(10));
+    }
+    reportAllocations(state, heapAllocations() - before);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PipelineSelection)->Apply(pipelineShapes);
@@ -0,0 +1,100 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reportSinkJson.hpp"
+#include "reportSinkNull.hpp"
+#include "reportSinkText.hpp"
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr size_t ARTICLES = 100'000; /**< Articles whose average rating is reported. */
+constexpr size_t BUFFER = 1 << 16;   /**< Buffer size of the buffered sinks. */
+
+/**
+ * @brief Get the titles of the reported articles.
+ * @return The titles.
+ */
+const std::vector<std::string>& titles()
+{
+    static const auto titles = [] {
+        std::vector<std::string> titles;
+        for (size_t article = 0; article < ARTICLES; ++article)
+        {
+            titles.push_back("Submitted article number " + std::to_string(article));
+        }
+        return titles;
+    }();
+    return titles;
+}
+
+/**
+ * @brief Report the average rating of every article, as the review phase does.
+ * @param state The benchmark state.
+ * @param makeSink Creates the sink writing to a stream.
+ */
+template <typename MakeSink> void reportRatings(benchmark::State& state, MakeSink makeSink)
+{
+    std::ofstream output("/dev/null");
+    for (auto _ : state)
+    {
+        const std::unique_ptr<ReportSink> sink = makeSink(output);
+        for (size_t article = 0; article < ARTICLES; ++article)
+        {
+            sink->report("articleRating", "Article '{}' has an average rating of {}",
+                         {{"article", titles()[article]}, {"rating", static_cast<std::int64_t>(article % 7) - 3}});
+        }
+        sink->flush();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ARTICLES));
+}
+} // namespace
+
+// The output of the review phase written line by line with std::endl, as before the report sinks
+static void BM_ReportRatingsEndl(benchmark::State& state)
+{
+    std::ofstream output("/dev/null");
+    for (auto _ : state)
+    {
+        for (size_t article = 0; article < ARTICLES; ++article)
+        {
+            output << "Article '" << titles()[article] << "' has an average rating of "
+                   << static_cast<int>(article % 7) - 3 << std::endl;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ARTICLES));
+}
+BENCHMARK(BM_ReportRatingsEndl)->Unit(benchmark::kMillisecond);
+
+static void BM_ReportRatingsText(benchmark::State& state)
+{
+    reportRatings(state, [](std::ostream& output) { return std::make_unique<ReportSinkText>(output); });
+}
+BENCHMARK(BM_ReportRatingsText)->Unit(benchmark::kMillisecond);
+
+static void BM_ReportRatingsBufferedText(benchmark::State& state)
+{
+    reportRatings(state, [](std::ostream& output) { return std::make_unique<ReportSinkText>(output, BUFFER); });
+}
+BENCHMARK(BM_ReportRatingsBufferedText)->Unit(benchmark::kMillisecond);
+
+static void BM_ReportRatingsBufferedJson(benchmark::State& state)
+{
+    reportRatings(state, [](std::ostream& output) { return std::make_unique<ReportSinkJson>(output, BUFFER); });
+}
+BENCHMARK(BM_ReportRatingsBufferedJson)->Unit(benchmark::kMillisecond);
+
+static void BM_ReportRatingsNull(benchmark::State& state)
+{
+    reportRatings(state, [](std::ostream& /*output*/) { return std::make_unique<ReportSinkNull>(); });
+}
+BENCHMARK(BM_ReportRatingsNull)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,110 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "allocationCounter.hpp"
+#include "articleRegular.hpp"
+#include "reviewer.hpp"
+#include "selectionStrategyBest.hpp"
+#include "selectionStrategyFixedCut.hpp"
+#include "trackFactory.hpp"
+#include "trackStateBidding.hpp"
+#include "trackStateReview.hpp"
+#include "trackStateSelection.hpp"
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <string>
+
+namespace
+{
+std::shared_ptr<Track> makeReviewedTrack(size_t amount)
+{
+    auto track = TrackFactory::createTrack(R"( { "trackType": "regular", "trackTopic": "Benchmark" } )"_json);
+    track->addReviewer(std::make_shared<Reviewer>(R"(
+    {
+            "name": "Martin Venturino",
+            "affiliation": "Tecnicas y herramientas",
+            "email": "marven@tyh.com",
+            "password": "1234",
+            "isChair": false,
+            "isAuthor": false,
+            "isReviewer": true
+    }
+    )"_json));
+
+    for (size_t i = 0; i < amount; ++i)
+    {
+        nlohmann::json articleJson = {{"articleTitle", "Submitted article number " + std::to_string(i)},
+                                      {"attachedFileUrl", "https://bit.ly/example"},
+                                      {"abstract", "Detailed exploration of modern C++ features."}};
+        track->handleTrackArticle(std::make_shared<ArticleRegular>(articleJson), OperationType::Create);
+    }
+
+    // Run the bidding and review phases quietly
+    std::cout.setstate(std::ios::failbit);
+    track->establishState(BiddingStateTrack{});
+    track->handleTrackBidding();
+    track->establishState(ReviewStateTrack{});
+    track->handleTrackReview();
+    std::cout.clear();
+
+    track->establishState(SelectionStateTrack{});
+    return track;
+}
+
+void runSelection(benchmark::State& state, const std::shared_ptr<SelectionStrategy>& strategy, int threshold)
+{
+    const auto track = makeReviewedTrack(state.range(0));
+    track->selectionStrategy(strategy);
+
+    // The first selection sizes the reusable buffers, every later one must not touch the heap
+    track->handleTrackSelection(threshold);
+    const auto before = heapAllocations();
+    for (auto _ : state)
+    {
+        track->handleTrackSelection(threshold);
+        benchmark::DoNotOptimize(track->selectedArticles().data());
+    }
+    const auto allocated = heapAllocations() - before;
+
+    state.counters["allocations"] = static_cast<double>(allocated);
+    state.counters["selected"] = static_cast<double>(track->selectedArticles().size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    if (allocated != 0)
+    {
+        state.SkipWithError("The selection path allocated on the heap");
+    }
+}
+} // namespace
+
+// Selection of every article above a rating
+static void BM_SelectionBestAllocations(benchmark::State& state)
+{
+    runSelection(state, std::make_shared<SelectionStrategyBest>(), -3);
+}
+BENCHMARK(BM_SelectionBestAllocations)->Arg(50'000)->Unit(benchmark::kMicrosecond);
+
+// Selection of the best rated half of the articles
+static void BM_SelectionFixedCutAllocations(benchmark::State& state)
+{
+    runSelection(state, std::make_shared<SelectionStrategyFixedCut>(), 50);
+}
+BENCHMARK(BM_SelectionFixedCutAllocations)->Arg(50'000)->Unit(benchmark::kMicrosecond);
+
+// Selection of the best rated articles only
+static void BM_SelectionBestTopRating(benchmark::State& state)
+{
+    runSelection(state, std::make_shared<SelectionStrategyBest>(), 3);
+}
+BENCHMARK(BM_SelectionBestTopRating)->Arg(50'000)->Unit(benchmark::kMicrosecond);
+
+// Selection of the best rated percent of the articles
+static void BM_SelectionFixedCutOnePercent(benchmark::State& state)
+{
+    runSelection(state, std::make_shared<SelectionStrategyFixedCut>(), 1);
+}
+BENCHMARK(BM_SelectionFixedCutOnePercent)->Arg(50'000)->Unit(benchmark::kMicrosecond);
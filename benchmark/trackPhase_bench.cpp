@@ -0,0 +1,88 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "articleRegular.hpp"
+#include "reportSinkNull.hpp"
+#include "trackFactory.hpp"
+#include "trackPhase.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+
+namespace
+{
+/**
+ * @brief Create a track holding one article, reporting to a null sink.
+ * @return The track, in the reception state.
+ */
+std::shared_ptr<Track> quietTrack()
+{
+    auto track = TrackFactory::createTrack({{"trackType", "regular"}, {"trackTopic", "C++"}});
+    track->reportSink(std::make_shared<ReportSinkNull>());
+    track->handleTrackArticle(std::make_shared<ArticleRegular>(nlohmann::json{
+                                  {"articleTitle", "Modern C++"},
+                                  {"attachedFileUrl", "https://bit.ly/example"},
+                                  {"abstract", "Concepts, ranges and coroutines in practice"}}),
+                              OperationType::Create);
+    return track;
+}
+} // namespace
+
+// A late submission, rejected because the track is already bidding
+static void BM_TrackPhaseRejectedArticle(benchmark::State& state)
+{
+    const auto track = quietTrack();
+    const auto article = track->articles().front();
+    track->establishState(BiddingStateTrack{});
+    for (auto _ : state)
+    {
+        track->handleTrackArticle(article, OperationType::Update);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TrackPhaseRejectedArticle);
+
+// A bidding request, rejected because the track is still receiving articles
+static void BM_TrackPhaseRejectedBidding(benchmark::State& state)
+{
+    const auto track = quietTrack();
+    for (auto _ : state)
+    {
+        track->handleTrackBidding();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TrackPhaseRejectedBidding);
+
+// The four phases of a track, one transition after the other
+static void BM_TrackPhaseTransitions(benchmark::State& state)
+{
+    const auto track = quietTrack();
+    for (auto _ : state)
+    {
+        track->establishState(ReceptionStateTrack{});
+        track->establishState(BiddingStateTrack{});
+        track->establishState(ReviewStateTrack{});
+        track->establishState(SelectionStateTrack{});
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_TrackPhaseTransitions);
+
+// One review folded into the score of its article during the review phase
+static void BM_TrackSubmitReview(benchmark::State& state)
+{
+    const auto track = quietTrack();
+    track->establishState(ReviewStateTrack{});
+    const Review review("Solid work", Rating::Good, Confidence::High);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(track->submitReview(0, review));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TrackSubmitReview);
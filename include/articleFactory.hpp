@@ -0,0 +1,66 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ARTICLE_FACTORY_HPP
+#define ARTICLE_FACTORY_HPP
+
+#include "articleInterface.hpp"
+#include "articlePoster.hpp"
+#include "articleRegular.hpp"
+#include <memory>
+#include <nlohmann/json.hpp>
+
+/**
+ * @class ArticleFactory
+ * @brief Factory class for creating articles.
+ *
+ * The ArticleFactory class provides a static method for creating Article objects
+ * based on the provided JSON data. It supports the creation of the different types
+ * of articles, such as regular articles and posters.
+ */
+class ArticleFactory
+{
+  public:
+    /**
+     * @brief Creates an article based on the provided JSON data.
+     * @param articleData A JSON object containing the article data.
+     * @return A shared pointer to the created Article object.
+     *
+     * This method examines the "articleType" field in the JSON data to determine
+     * the type of article to create. It returns a shared pointer to the appropriate
+     * Article subclass based on the "articleType". If the article type is unknown or
+     * missing, it throws an invalid_argument exception.
+     */
+    static std::shared_ptr<Article> createArticle(const nlohmann::json& articleData)
+    {
+        try
+        {
+            const std::string& articleType = articleData.at("articleType");
+            if (articleType == "regular")
+            {
+                return std::make_shared<ArticleRegular>(articleData);
+            }
+            else if (articleType == "poster")
+            {
+                return std::make_shared<ArticlePoster>(articleData);
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown article type: " + articleType +
+                                            ". Did you check if the key 'articleType' is present?");
+            }
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw std::invalid_argument("Invalid article data: " + std::string(e.what()) +
+                                        ". Did you check if the key 'articleType' is present?");
+        }
+    }
+};
+
+#endif // ARTICLE_FACTORY_HPP
@@ -0,0 +1,125 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ARTICLE_INDEX_HPP
+#define ARTICLE_INDEX_HPP
+
+#include "articleInterface.hpp"
+#include "identifiers.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ArticleIndex
+ * @brief Owns the articles of a track and keeps them indexed by title.
+ *
+ * The ArticleIndex class stores the articles submitted to a track in a contiguous
+ * vector, alongside a title-keyed hash index that supports heterogeneous lookup
+ * with std::string_view. Both structures are kept consistent across insertions
+ * and removals, so updating or deleting an article by title costs O(1) instead of
+ * a linear scan, and duplicated titles can be rejected on creation. The position of
+ * an article in the storage is its ArticleId, which indexes every per-article table
+ * of the track once submissions are closed.
+ */
+class ArticleIndex
+{
+  public:
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty ArticleIndex.
+     */
+    ArticleIndex() = default;
+
+    /**
+     * @brief Insert an article into the index.
+     * @param article The article to insert.
+     * @return True if the article was inserted, false if an article with the same title already exists.
+     *
+     * Appends the article to the storage and records its position under its title.
+     */
+    bool insert(const std::shared_ptr<Article>& article);
+
+    /**
+     * @brief Find an article by its title.
+     * @param title The title of the article to find.
+     * @return A pointer to the stored article, or nullptr if no article has that title.
+     *
+     * Performs an O(1) average lookup without building a temporary std::string.
+     */
+    Article* find(std::string_view title) const;
+
+    /**
+     * @brief Remove an article by its title.
+     * @param title The title of the article to remove.
+     * @return True if the article was removed, false if no article has that title.
+     *
+     * The removed slot is filled with the last article, so the relative order of the
+     * remaining articles is not preserved.
+     */
+    bool erase(std::string_view title);
+
+    /**
+     * @brief Reserve storage for a number of articles.
+     * @param capacity The number of articles to make room for.
+     *
+     * Avoids repeated reallocations of the storage and rehashing of the index when
+     * the amount of submissions is known in advance.
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * @brief Get the number of articles in the index.
+     * @return The number of stored articles.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check whether the index is empty.
+     * @return True if there are no stored articles, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the stored articles.
+     * @return A constant reference to the vector of stored articles, indexed by ArticleId.
+     *
+     * Provides contiguous access to the articles for the bidding, review and selection phases.
+     */
+    const std::vector<std::shared_ptr<Article>>& articles() const;
+
+  private:
+    /**
+     * @struct TitleHash
+     * @brief Transparent hash enabling lookups by std::string_view.
+     */
+    struct TitleHash
+    {
+        using is_transparent = void; /**< Enables heterogeneous lookup. */
+
+        /**
+         * @brief Hash a title.
+         * @param title The title to hash.
+         * @return The hash value of the title.
+         */
+        size_t operator()(std::string_view title) const
+        {
+            return std::hash<std::string_view>{}(title);
+        }
+    };
+
+    std::vector<std::shared_ptr<Article>> m_articles; /**< The stored articles. */
+    std::unordered_map<std::string, size_t, TitleHash, std::equal_to<>>
+        m_positions; /**< A map associating titles with their position in the storage. */
+};
+
+#endif // ARTICLE_INDEX_HPP
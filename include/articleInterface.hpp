@@ -10,6 +10,7 @@
 #define ARTICLE_INTERFACE_HPP
 
 #include "nlohmann/json.hpp"
+#include "reportSink.hpp"
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -43,6 +44,16 @@ class Article
      */
     explicit Article(const nlohmann::json& articleJson);
 
+    /**
+     * @brief Parameterized constructor to initialize an article with its fields.
+     * @param title The article's title.
+     * @param attachedUrl The URL of the article's attached file.
+     * @param authors The authors of the article.
+     *
+     * Constructs an Article object directly from its metadata, without going through JSON.
+     */
+    Article(std::string title, std::string attachedUrl, std::vector<std::string> authors);
+
     /**
      * @brief Virtual method to update the article's fields.
      * @param article A shared pointer to another Article object containing updated fields.
@@ -62,14 +73,27 @@ class Article
      */
     virtual const std::string& articleName() const = 0;
 
+    /**
+     * @brief Get the URL of the article's attached file.
+     * @return A constant reference to the URL.
+     */
+    const std::string& attachedUrl() const;
+
+    /**
+     * @brief Get the authors of the article.
+     * @return A constant reference to the list of authors.
+     */
+    const std::vector<std::string>& authors() const;
+
     /**
      * @brief Display the article's metadata.
+     * @param sink The sink receiving the metadata.
      *
-     * Outputs the article's details to the standard output, providing a user-friendly
+     * Outputs the article's details to the sink, providing a user-friendly
      * overview of the article's metadata. Can be overridden by derived classes for
      * customized display.
      */
-    virtual void display() const;
+    virtual void display(ReportSink& sink = *ReportSink::standard()) const;
 
     /**
      * @brief Pure virtual method to check if the article is valid.
@@ -82,6 +106,12 @@ class Article
     virtual bool isValid() const = 0;
 
   protected:
+    /**
+     * @brief Get the authors of the article as one line.
+     * @return The names of the authors, separated by commas.
+     */
+    std::string authorList() const;
+
     std::string m_title;                ///< The article's title.
     std::string m_attachedUrl;          ///< The URL of the article's attached file.
     std::vector<std::string> m_authors; ///< List of authors associated with the article.
@@ -42,6 +42,18 @@ class ArticlePoster : public Article
      */
     explicit ArticlePoster(const nlohmann::json& articleJson);
 
+    /**
+     * @brief Parameterized constructor to initialize a poster with its fields.
+     * @param title The article's title.
+     * @param attachedUrl The URL of the article's attached file.
+     * @param authors The authors of the article.
+     * @param secondAttachment The URL of the secondary attachment.
+     *
+     * Constructs a ArticlePoster object directly from its metadata, without going through JSON.
+     */
+    ArticlePoster(std::string title, std::string attachedUrl, std::vector<std::string> authors,
+                  std::string secondAttachment);
+
     /**
      * @brief Override method to update the poster article's fields.
      * @param article A shared pointer to another Article object containing updated fields.
@@ -62,12 +74,13 @@ class ArticlePoster : public Article
 
     /**
      * @brief Override method to display the poster article's information.
+     * @param sink The sink receiving the metadata.
      *
-     * Outputs the poster article's details to the standard output, including the
+     * Outputs the poster article's details to the sink, including the
      * secondary attachment URL. This provides a comprehensive overview of the poster's
      * metadata, enhancing user understanding.
      */
-    void display() const override;
+    void display(ReportSink& sink = *ReportSink::standard()) const override;
 
     /**
      * @brief Override method to check if the poster article is valid.
@@ -79,6 +92,12 @@ class ArticlePoster : public Article
      */
     bool isValid() const override;
 
+    /**
+     * @brief Get the secondary attachment of the poster.
+     * @return A constant reference to the URL of the secondary attachment.
+     */
+    const std::string& secondAttachment() const;
+
   private:
     std::string m_secondAttach; ///< URL for the secondary attachment specific to poster articles.
 };
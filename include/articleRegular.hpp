@@ -42,6 +42,17 @@ class ArticleRegular : public Article
      */
     explicit ArticleRegular(const nlohmann::json& articleJson);
 
+    /**
+     * @brief Parameterized constructor to initialize a regular article with its fields.
+     * @param title The article's title.
+     * @param attachedUrl The URL of the article's attached file.
+     * @param authors The authors of the article.
+     * @param abstract The abstract of the article.
+     *
+     * Constructs a ArticleRegular object directly from its metadata, without going through JSON.
+     */
+    ArticleRegular(std::string title, std::string attachedUrl, std::vector<std::string> authors, std::string abstract);
+
     /**
      * @brief Override method to update the regular article's fields.
      * @param article A shared pointer to another Article object containing updated fields.
@@ -62,12 +73,13 @@ class ArticleRegular : public Article
 
     /**
      * @brief Override method to display the regular article's information.
+     * @param sink The sink receiving the metadata.
      *
-     * Outputs the regular article's details to the standard output, including the
+     * Outputs the regular article's details to the sink, including the
      * abstract. This provides a comprehensive overview of the article's metadata,
      * enhancing user understanding.
      */
-    void display() const override;
+    void display(ReportSink& sink = *ReportSink::standard()) const override;
 
     /**
      * @brief Override method to check if the regular article is valid.
@@ -79,6 +91,12 @@ class ArticleRegular : public Article
      */
     bool isValid() const override;
 
+    /**
+     * @brief Get the abstract of the regular article.
+     * @return A constant reference to the abstract.
+     */
+    const std::string& abstract() const;
+
   private:
     std::string m_abstract; ///< Abstract providing a short description of the regular article.
 };
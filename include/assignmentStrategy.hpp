@@ -0,0 +1,79 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ASSIGNMENT_STRATEGY_HPP
+#define ASSIGNMENT_STRATEGY_HPP
+
+#include "bidMatrix.hpp"
+#include "conflictMask.hpp"
+#include "identifiers.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @struct ReviewAssignment
+ * @brief A reviewer assigned to review an article.
+ *
+ * Reviewers and articles are identified by their dense ids in the track, matching
+ * the rows and columns of the BidMatrix the assignment was computed from.
+ */
+struct ReviewAssignment
+{
+    ReviewerId reviewer; /**< The id of the reviewer. */
+    ArticleId article;   /**< The id of the article. */
+};
+
+/**
+ * @class AssignmentStrategy
+ * @brief Abstract base class representing a strategy for assigning articles to reviewers.
+ *
+ * The AssignmentStrategy class defines the interface for the algorithms that decide which
+ * reviewer reviews which article, based on the bids placed during the bidding phase.
+ * Subclasses trade off the cost of the computation against the quality of the assignment.
+ */
+class AssignmentStrategy
+{
+  public:
+    /**
+     * @brief Virtual destructor.
+     *
+     * Ensures proper cleanup of derived classes.
+     */
+    virtual ~AssignmentStrategy() = default;
+
+    /**
+     * @brief Get the number of reviews each article should receive.
+     * @return The quota of reviews of an article, before it is capped by the number of reviewers.
+     *
+     * This pure virtual method must be implemented by derived classes, so the review phase can
+     * leave the articles that already hold their quota out of the assignment.
+     */
+    virtual std::uint32_t reviewsPerArticle() const = 0;
+
+    /**
+     * @brief Assign articles to reviewers.
+     * @param assignments The vector to store the computed assignments.
+     * @param bids The bids of every reviewer on every article.
+     * @param conflicts The pairs that must not be assigned, empty when there is no conflict of interest.
+     * @param reviewed The reviews the articles already hold. Each one counts against the quota of its article, and
+     * its pair is never assigned again. A review whose reviewer is not a reviewer of the bids, such as one submitted
+     * without a known reviewer, only counts against the quota.
+     *
+     * This pure virtual method must be implemented by derived classes to define
+     * the assignment algorithm. The method replaces the content of the assignments
+     * vector with one entry per review still missing, none of them on a masked or an
+     * already reviewed pair. Any scratch memory the algorithm needs is allocated from
+     * the resource of the assignments, which the review phase points to its arena.
+     */
+    virtual void assign(std::pmr::vector<ReviewAssignment>& assignments, const BidMatrix& bids,
+                        const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed) = 0;
+};
+
+#endif // ASSIGNMENT_STRATEGY_HPP
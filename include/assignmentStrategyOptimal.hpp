@@ -0,0 +1,76 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ASSIGNMENT_STRATEGY_OPTIMAL_HPP
+#define ASSIGNMENT_STRATEGY_OPTIMAL_HPP
+
+#include "assignmentStrategy.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class AssignmentStrategyOptimal
+ * @brief Implements an assignment strategy that maximizes the total bidding affinity.
+ *
+ * The AssignmentStrategyOptimal class extends the AssignmentStrategy class to solve the
+ * reviewer assignment as a min-cost flow problem: every article must receive a quota of
+ * reviews, every reviewer can take a bounded load, and each reviewer-article pair costs
+ * the inverse of the interest the reviewer expressed on the article. The flow is computed
+ * with a primal-dual algorithm that runs Dijkstra on reduced costs to update the node
+ * potentials and then saturates every shortest augmenting path at once with blocking
+ * flows, so the number of shortest path computations stays bounded by the few distinct
+ * path costs instead of growing with the number of reviews.
+ */
+class AssignmentStrategyOptimal : public AssignmentStrategy
+{
+  public:
+    /**
+     * @brief Constructor.
+     * @param reviewsPerArticle The number of reviews each article should receive.
+     * @param reviewerCapacity The maximum number of articles per reviewer, or 0 to spread the load evenly.
+     *
+     * The number of reviews is capped by the number of reviewers at assignment time. When the
+     * capacity is too small to cover every review, the largest possible assignment is returned.
+     */
+    explicit AssignmentStrategyOptimal(std::uint32_t reviewsPerArticle = 3, std::uint32_t reviewerCapacity = 0);
+
+    /**
+     * @brief Get the number of reviews each article should receive.
+     * @return The number of reviews given to the constructor.
+     */
+    std::uint32_t reviewsPerArticle() const override;
+
+    /**
+     * @brief Assign articles to reviewers maximizing the total affinity.
+     * @param assignments The vector to store the computed assignments.
+     * @param bids The bids of every reviewer on every article.
+     * @param conflicts The pairs that must not be assigned.
+     * @param reviewed The reviews the articles already hold.
+     *
+     * Only the reviews still missing are assigned, spread evenly unless a capacity was given.
+     * The assignments are sorted by article and then by reviewer. It overrides the pure
+     * virtual method defined in the AssignmentStrategy base class.
+     */
+    void assign(std::pmr::vector<ReviewAssignment>& assignments, const BidMatrix& bids,
+                const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed) override;
+
+    /**
+     * @brief Get the affinity of a bid.
+     * @param interest The bidding interest of a reviewer on an article.
+     * @return The affinity, from 0 for NotInterested to 3 for Interested.
+     *
+     * A missing bid ranks above an explicit lack of interest.
+     */
+    static std::uint32_t affinity(BiddingInterest interest);
+
+  private:
+    std::uint32_t m_reviewsPerArticle; /**< The number of reviews each article should receive. */
+    std::uint32_t m_reviewerCapacity;  /**< The maximum number of articles per reviewer, 0 for automatic. */
+};
+
+#endif // ASSIGNMENT_STRATEGY_OPTIMAL_HPP
@@ -0,0 +1,60 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ASSIGNMENT_STRATEGY_ROUND_ROBIN_HPP
+#define ASSIGNMENT_STRATEGY_ROUND_ROBIN_HPP
+
+#include "assignmentStrategy.hpp"
+#include <vector>
+
+/**
+ * @class AssignmentStrategyRoundRobin
+ * @brief Implements a cheap assignment strategy that deals articles to reviewers in turns.
+ *
+ * The AssignmentStrategyRoundRobin class extends the AssignmentStrategy class to rank the
+ * articles by the total interest they received and hand them out to the reviewers in turns.
+ * It runs in linear time on the size of the bid matrix but ignores the interest of each
+ * individual reviewer.
+ */
+class AssignmentStrategyRoundRobin : public AssignmentStrategy
+{
+  public:
+    /**
+     * @brief Constructor.
+     * @param reviewsPerArticle The number of reviews each article should receive.
+     *
+     * The number of reviews is capped by the number of reviewers at assignment time.
+     */
+    explicit AssignmentStrategyRoundRobin(std::uint32_t reviewsPerArticle = 1);
+
+    /**
+     * @brief Get the number of reviews each article should receive.
+     * @return The number of reviews given to the constructor.
+     */
+    std::uint32_t reviewsPerArticle() const override;
+
+    /**
+     * @brief Assign articles to reviewers in turns.
+     * @param assignments The vector to store the computed assignments.
+     * @param bids The bids of every reviewer on every article.
+     * @param conflicts The pairs that must not be assigned.
+     * @param reviewed The reviews the articles already hold.
+     *
+     * Articles with the most interest are dealt first, each one to the next reviewers in the
+     * rotation until it holds its quota, passing over the reviewers in conflict with the article
+     * and the ones that already reviewed it. It overrides the pure virtual method defined in the
+     * AssignmentStrategy base class.
+     */
+    void assign(std::pmr::vector<ReviewAssignment>& assignments, const BidMatrix& bids,
+                const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed) override;
+
+  private:
+    std::uint32_t m_reviewsPerArticle; /**< The number of reviews each article should receive. */
+};
+
+#endif // ASSIGNMENT_STRATEGY_ROUND_ROBIN_HPP
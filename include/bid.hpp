@@ -9,6 +9,8 @@
 #ifndef BID_HPP
 #define BID_HPP
 
+#include "reportSink.hpp"
+#include <cstdint>
 #include <string>
 
 /**
@@ -17,8 +19,9 @@
  *
  * This enumeration defines the levels of interest a reviewer can express
  * when bidding on an article. The levels range from no interest to high interest.
+ * It is stored in a single byte so that bid matrices stay compact.
  */
-enum class BiddingInterest
+enum class BiddingInterest : std::uint8_t
 {
     None,
     NotInterested,
@@ -78,11 +81,12 @@ class Bid
 
     /**
      * @brief Display a summary of the bid.
+     * @param sink The sink receiving the summary.
      *
-     * Outputs a summary of the bid to the standard output, including the
+     * Outputs a summary of the bid to the sink, including the
      * reviewer's name and their level of interest in the article.
      */
-    void bidSummary() const;
+    void bidSummary(ReportSink& sink = *ReportSink::standard()) const;
 
     /**
      * @brief Overload the greater than operator.
@@ -0,0 +1,114 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef BID_MATRIX_HPP
+#define BID_MATRIX_HPP
+
+#include "bid.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @class BidMatrix
+ * @brief Dense reviewer by article matrix of bidding interests.
+ *
+ * The BidMatrix class keeps the bid of every reviewer on every article of a track
+ * in a single contiguous buffer of one-byte BiddingInterest cells. Reviewers and
+ * articles are addressed by their position in the track, so no hashing is needed
+ * to read or write a bid. Cells are stored article-major: all the bids placed on
+ * one article are contiguous, which is the access pattern of review assignment.
+ */
+class BidMatrix
+{
+  public:
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty BidMatrix.
+     */
+    BidMatrix() = default;
+
+    /**
+     * @brief Constructor allocating from a memory resource.
+     * @param resource The resource the matrix allocates from, which must outlive it.
+     *
+     * Initializes an empty BidMatrix, such as the transient bids of a review phase built from its arena.
+     */
+    explicit BidMatrix(std::pmr::memory_resource* resource);
+
+    /**
+     * @brief Resize the matrix and clear every bid.
+     * @param reviewers The number of reviewers (rows).
+     * @param articles The number of articles (columns).
+     *
+     * Every cell is set to BiddingInterest::None.
+     */
+    void reset(size_t reviewers, size_t articles);
+
+    /**
+     * @brief Get the bid of a reviewer on an article.
+     * @param reviewer The position of the reviewer in the track.
+     * @param article The position of the article in the track.
+     * @return The bidding interest stored in the cell.
+     */
+    BiddingInterest at(size_t reviewer, size_t article) const;
+
+    /**
+     * @brief Set the bid of a reviewer on an article.
+     * @param reviewer The position of the reviewer in the track.
+     * @param article The position of the article in the track.
+     * @param interest The bidding interest to store.
+     */
+    void set(size_t reviewer, size_t article, BiddingInterest interest);
+
+    /**
+     * @brief Get all the bids placed on an article.
+     * @param article The position of the article in the track.
+     * @return A view over the bids of every reviewer on the article, indexed by reviewer position.
+     */
+    std::span<const BiddingInterest> articleBids(size_t article) const;
+
+    /**
+     * @brief Get the number of reviewers in the matrix.
+     * @return The number of rows.
+     */
+    size_t reviewers() const;
+
+    /**
+     * @brief Get the number of articles in the matrix.
+     * @return The number of columns.
+     */
+    size_t articles() const;
+
+    /**
+     * @brief Get the number of bids in the matrix.
+     * @return The number of cells, one per reviewer and article.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check whether the matrix holds any bid.
+     * @return True if there are no cells, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the resource the matrix allocates from.
+     * @return The memory resource of the cells.
+     */
+    std::pmr::memory_resource* resource() const;
+
+  private:
+    size_t m_reviewers{0};                     /**< The number of reviewers (rows). */
+    size_t m_articles{0};                      /**< The number of articles (columns). */
+    std::pmr::vector<BiddingInterest> m_cells; /**< The bids, stored article-major. */
+};
+
+#endif // BID_MATRIX_HPP
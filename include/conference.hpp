@@ -9,9 +9,14 @@
 #ifndef CONFERENCE_HPP
 #define CONFERENCE_HPP
 
+#include "conflictIndex.hpp"
+#include "mutationLog.hpp"
+#include "reportSink.hpp"
+#include "reviewer.hpp"
 #include "track.hpp"
 #include "user.hpp"
 #include <chrono>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -52,11 +57,11 @@ class Conference
 
     /**
      * @brief Get the tracks associated with the conference.
-     * @return A vector of shared pointers to Track objects representing the conference tracks.
+     * @return A constant reference to the vector of Track objects representing the conference tracks.
      *
      * Retrieves the list of tracks that are part of the conference.
      */
-    std::vector<std::shared_ptr<Track>> tracks();
+    const std::vector<std::shared_ptr<Track>>& tracks() const;
 
     /**
      * @brief Get the creation date and time of the conference.
@@ -122,10 +127,45 @@ class Conference
      */
     size_t sizeParticipants();
 
+    /**
+     * @brief Get the seed of the simulated bids and reviews.
+     * @return The seed shared by every reviewer of the conference.
+     */
+    std::uint64_t seed() const;
+
+    /**
+     * @brief Set the seed of the simulated bids and reviews.
+     * @param seed The seed to give to every reviewer of the conference.
+     *
+     * Two runs of a conference with the same seed place the same bids and write the
+     * same reviews, whatever the number of threads used. The seed can also be given
+     * in the "seed" field of the conference JSON.
+     */
+    void seed(std::uint64_t seed);
+
+    /**
+     * @brief Set the sink receiving the messages of the conference and of its tracks.
+     * @param sink The sink, for instance buffered text, JSON lines or a null sink.
+     *
+     * Tracks created afterwards also report to the sink. Messages go to the standard
+     * output until a sink is set.
+     */
+    void reportSink(const std::shared_ptr<ReportSink>& sink);
+
+    /**
+     * @brief Record the mutations of every track of the conference in a write-ahead log.
+     * @param log The log, or a null pointer to stop recording.
+     *
+     * Each track records its mutations under its position in the conference, which is
+     * how MutationLog::replay finds it again. Attach the log once the conference is
+     * loaded and any previous log has been replayed.
+     */
+    void mutationLog(const std::shared_ptr<MutationLog>& log);
+
     /**
      * @brief Print a summary of the bidding process.
      *
-     * Outputs a summary of the bidding activities, providing an overview of
+     * Outputs to the report sink a summary of the bidding activities, providing an overview of
      * the bids placed by reviewers on the conference tracks.
      */
     void printBiddingSummary();
@@ -133,12 +173,43 @@ class Conference
     /**
      * @brief Print a summary of the review process.
      *
-     * Outputs a summary of the review activities, providing an overview of
+     * Outputs to the report sink a summary of the review activities, providing an overview of
      * the reviews conducted by reviewers on the conference tracks.
      */
     void printReviewSummary();
 
   private:
+    friend class ConferenceLoader;
+    friend class ConferenceSnapshot;
+
+    /**
+     * @brief Add a user described in JSON to the conference.
+     * @param userJson A JSON object containing the user's information.
+     *
+     * Users flagged as reviewers are registered by full name, so tracks can list
+     * them as reviewers, and receive the seed of the conference. A user sharing the
+     * name of an earlier one under another affiliation is reported as a duplicate.
+     */
+    void addUser(const nlohmann::json& userJson);
+
+    /**
+     * @brief Create a track described in JSON and add it to the conference.
+     * @param trackJson A JSON object containing the track's information.
+     * @return The created track.
+     *
+     * Throws an exception, without adding the track, if its type is unknown or one of
+     * its reviewers is not a user of the conference.
+     */
+    std::shared_ptr<Track> addTrack(const nlohmann::json& trackJson);
+
+    /**
+     * @brief Set the creation date from the conference JSON data.
+     * @param conferenceJson A JSON object holding the "createdAt" field, if any.
+     *
+     * Uses the current time when the field is missing.
+     */
+    void createdAt(const nlohmann::json& conferenceJson);
+
     /**
      * @brief Parse a date string into a time point.
      * @param dateStr The date string to parse.
@@ -149,8 +220,11 @@ class Conference
     std::chrono::system_clock::time_point parseDate(const std::string& dateStr);
 
     std::vector<std::shared_ptr<User>> m_users; /**< List of users involved in the conference. */
-    std::unordered_map<std::string, std::shared_ptr<User>> m_reviewers; /**< Map of reviewer names to user objects. */
-    std::vector<std::shared_ptr<Track>> m_tracks;                       /**< List of tracks in the conference. */
+    std::unordered_map<std::string, std::shared_ptr<Reviewer>> m_reviewers; /**< Map of reviewer names to reviewers. */
+    std::vector<std::shared_ptr<Track>> m_tracks;                           /**< List of tracks in the conference. */
+    std::uint64_t m_seed{0};                                                /**< Seed of the simulated decisions. */
+    std::shared_ptr<ReportSink> m_reportSink{ReportSink::standard()};       /**< Sink receiving the messages. */
+    std::shared_ptr<ConflictIndex> m_conflicts{std::make_shared<ConflictIndex>()}; /**< Affiliations of the users */
     std::chrono::system_clock::time_point m_createdAt;     /**< Timestamp indicating when the conference was created. */
     std::chrono::system_clock::time_point m_biddingStart;  /**< Timestamp for the start of the bidding phase. */
     std::chrono::system_clock::time_point m_revisionStart; /**< Timestamp for the start of the revision phase. */
@@ -0,0 +1,169 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFERENCE_GENERATOR_HPP
+#define CONFERENCE_GENERATOR_HPP
+
+#include "articleInterface.hpp"
+#include "conference.hpp"
+#include "randomStream.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ConferenceShape
+ * @brief The size of a synthetic conference and the distributions of its people.
+ *
+ * Affiliations and authors follow Zipf laws: the k-th affiliation gathers a share of the
+ * users proportional to 1 / k^affiliationSkew, and the k-th author signs a share of the
+ * articles proportional to 1 / k^authorSkew, a skew of 0 being uniform. With a positive
+ * bidSkew, each reviewer bids on a share u^bidSkew of its articles, u being uniform in
+ * [0, 1), so a few reviewers place most of the bids; with 0, reviewers keep their default
+ * bidding.
+ */
+struct ConferenceShape
+{
+    std::size_t tracks{1};              /**< The number of tracks. */
+    std::size_t articles{200};          /**< The number of articles submitted to each track. */
+    std::size_t reviewers{40};          /**< The number of reviewers of the conference. */
+    std::size_t reviewersPerTrack{0};   /**< The reviewers of each track, 0 for every reviewer. */
+    std::uint32_t reviewsPerArticle{3}; /**< The number of reviews each article should receive. */
+    std::size_t authors{400};           /**< The number of authors, who are not reviewers. */
+    std::size_t affiliations{20};       /**< The number of affiliations shared by the users. */
+    double affiliationSkew{0.8};        /**< The exponent of the Zipf law of the affiliation sizes. */
+    double authorSkew{0.3};             /**< The exponent of the Zipf law of the articles per author. */
+    double bidSkew{0.0};                /**< The exponent of the bid rates of the reviewers, 0 for none. */
+    std::uint64_t seed{0};              /**< The seed of the generator and of the conference. */
+
+    /**
+     * @brief Get the shape of a large production conference.
+     * @return 100 tracks of 2,000 articles, 10,000 reviewers, 300 of them per track, 120,000
+     * authors from 1,500 affiliations and skewed bids.
+     */
+    static ConferenceShape production();
+};
+
+/**
+ * @class ConferenceGenerator
+ * @brief Deterministic generator of synthetic conferences of any size.
+ *
+ * The ConferenceGenerator class builds a conference from its ConferenceShape, for benchmarks
+ * and load tests. Every user, track and article is a pure function of the shape: names,
+ * affiliations and authors are drawn from a RandomStream keyed by the seed and by what they
+ * describe, so the same shape yields the same conference on every run, and the articles of a
+ * track can be generated again without generating the others.
+ *
+ * Reviewers are spread over the tracks in overlapping windows, every track assigning its
+ * articles in turns to reviewsPerArticle reviewers. Users of the same affiliation are in
+ * conflict of interest, as in any conference, so the masks are exercised as well.
+ *
+ * A conference can be built in memory or written as a JSON document, one track at a time,
+ * so documents of any size can be produced and then read by the ConferenceLoader.
+ */
+class ConferenceGenerator
+{
+  public:
+    /**
+     * @brief Parameterized constructor.
+     * @param shape The size of the conferences to generate.
+     */
+    explicit ConferenceGenerator(const ConferenceShape& shape);
+
+    /**
+     * @brief Get the size of the generated conferences.
+     * @return The shape of the generator.
+     */
+    const ConferenceShape& shape() const;
+
+    /**
+     * @brief Describe the users and tracks of the conference in JSON.
+     * @return The conference document, in the format read by the Conference constructor.
+     *
+     * The document lists the users and the reviewers of each track, but no article.
+     */
+    nlohmann::json describe() const;
+
+    /**
+     * @brief Write the conference document, articles included.
+     * @param output The stream receiving the document.
+     *
+     * Only the articles of one track are held at a time, each written as soon as it is
+     * described. The ConferenceLoader reads the document back into the conference that
+     * conference and submit would build.
+     */
+    void write(std::ostream& output) const;
+
+    /**
+     * @brief Create the conference, without any article.
+     * @return A shared pointer to a conference in which every track is receiving articles.
+     */
+    std::shared_ptr<Conference> conference() const;
+
+    /**
+     * @brief Generate the articles of a track.
+     * @param track The position of the track in the conference.
+     * @return The articles, in submission order.
+     */
+    std::vector<std::shared_ptr<Article>> articles(std::size_t track) const;
+
+    /**
+     * @brief Submit the articles of every track of a conference.
+     * @param conference A conference created by this generator.
+     */
+    void submit(Conference& conference) const;
+
+  private:
+    /**
+     * @brief Describe a track in JSON, without its articles.
+     * @param track The position of the track in the conference.
+     * @return The track document, listing its reviewers.
+     */
+    nlohmann::json describeTrack(std::size_t track) const;
+
+    /**
+     * @brief Draw from a discrete distribution.
+     * @param cumulative The cumulative weights of the values, in increasing order.
+     * @param stream The random stream of the draw.
+     * @return The value drawn, lower than the number of weights.
+     */
+    static std::size_t draw(const std::vector<double>& cumulative, RandomStream& stream);
+
+    /**
+     * @brief Get the name of a reviewer.
+     * @param reviewer The position of the reviewer.
+     * @return The full name of the reviewer.
+     */
+    static std::string reviewerName(std::size_t reviewer);
+
+    /**
+     * @brief Get the name of an author.
+     * @param author The position of the author.
+     * @return The full name of the author.
+     */
+    static std::string authorName(std::size_t author);
+
+    /**
+     * @brief Describe a user in JSON.
+     * @param name The full name of the user.
+     * @param domain Separates the streams of the reviewers from those of the authors.
+     * @param user The position of the user among the reviewers or the authors.
+     * @return The user document, with an affiliation drawn from the seed.
+     */
+    nlohmann::json describeUser(const std::string& name, std::uint32_t domain, std::size_t user) const;
+
+    ConferenceShape m_shape;            /**< The size of the generated conferences. */
+    std::vector<double> m_affiliations; /**< The cumulative weights of the affiliations. */
+    std::vector<double> m_authors;      /**< The cumulative weights of the authors. */
+};
+
+#endif // CONFERENCE_GENERATOR_HPP
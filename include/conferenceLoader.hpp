@@ -0,0 +1,163 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFERENCE_LOADER_HPP
+#define CONFERENCE_LOADER_HPP
+
+#include "conference.hpp"
+#include <istream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class ConferenceLoader
+ * @brief Streaming loader building a conference from its JSON document.
+ *
+ * The ConferenceLoader class reads a conference document with the SAX interface of
+ * nlohmann::json instead of parsing it into a DOM first. Only one element is held as
+ * JSON at a time: each user, each article and the small fields of the current track
+ * are materialized, turned into objects and dropped, so the memory needed on top of
+ * the conference itself does not grow with the size of the document. Users become
+ * User or Reviewer objects, tracks are created through the TrackFactory and articles
+ * through the ArticleFactory, then submitted to their track.
+ *
+ * Unlike the Conference constructor, the loader also submits the articles listed in
+ * each track. Tracks resolve their reviewers against the users read so far, so the
+ * "users" field must come before the "tracks" field, as in every exported document.
+ */
+class ConferenceLoader : public nlohmann::json_sax<nlohmann::json>
+{
+  public:
+    /**
+     * @brief Load a conference from a stream.
+     * @param input The stream holding the JSON document.
+     * @return A shared pointer to the loaded conference.
+     *
+     * Throws an invalid_argument exception if the document is not valid JSON or is
+     * not an object. Tracks and articles that cannot be created are reported and
+     * skipped, as the Conference constructor does for tracks.
+     */
+    static std::shared_ptr<Conference> load(std::istream& input);
+
+    /**
+     * @brief Load a conference from a file.
+     * @param path The path of the JSON document.
+     * @return A shared pointer to the loaded conference.
+     *
+     * Throws an invalid_argument exception if the file cannot be opened, in addition
+     * to the errors of loading from a stream.
+     */
+    static std::shared_ptr<Conference> load(const std::string& path);
+
+    // SAX events, called by the parser while it reads the document
+    bool null() override;
+    bool boolean(bool value) override;
+    bool number_integer(number_integer_t value) override;
+    bool number_unsigned(number_unsigned_t value) override;
+    bool number_float(number_float_t value, const string_t& text) override;
+    bool string(string_t& value) override;
+    bool binary(binary_t& value) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& value) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& lastToken,
+                     const nlohmann::detail::exception& error) override;
+
+  private:
+    /**
+     * @brief Levels of the document the loader walks through without materializing them.
+     */
+    enum class Level
+    {
+        Document, /**< Outside the root object. */
+        Root,     /**< Inside the root object. */
+        List,     /**< Inside the "users" or "tracks" array. */
+        Track,    /**< Inside a track object. */
+        Articles  /**< Inside the "articles" array of a track. */
+    };
+
+    /**
+     * @brief Private constructor, loaders are only used through load.
+     * @param conference The conference to fill.
+     */
+    explicit ConferenceLoader(std::shared_ptr<Conference> conference);
+
+    /**
+     * @brief Handle a scalar value of the document.
+     * @param value The value.
+     * @return Always true, to keep parsing.
+     */
+    bool scalar(nlohmann::json&& value);
+
+    /**
+     * @brief Handle the start of an object or an array of the document.
+     * @param value An empty object or array.
+     * @return Always true, to keep parsing.
+     */
+    bool open(nlohmann::json&& value);
+
+    /**
+     * @brief Handle the end of an object or an array of the document.
+     * @return Always true, to keep parsing.
+     */
+    bool close();
+
+    /**
+     * @brief Enter a container the loader walks through instead of materializing it.
+     * @param isObject Whether the container is an object or an array.
+     * @return True if the container is part of the structure, false if it is an element to materialize.
+     */
+    bool enter(bool isObject);
+
+    /**
+     * @brief Store a value in the element being materialized.
+     * @param value The value.
+     * @return The stored value.
+     */
+    nlohmann::json* place(nlohmann::json&& value);
+
+    /**
+     * @brief Turn a fully materialized element into conference objects.
+     */
+    void complete();
+
+    /**
+     * @brief Create the current track from the fields read so far.
+     */
+    void createTrack();
+
+    /**
+     * @brief Create an article and submit it to the current track.
+     * @param articleJson The JSON object describing the article.
+     */
+    void addArticle(const nlohmann::json& articleJson);
+
+    /**
+     * @brief Finish the current track, creating it if none of its articles did.
+     */
+    void endTrack();
+
+    std::shared_ptr<Conference> m_conference;      /**< The conference being loaded. */
+    Level m_level{Level::Document};                /**< The structural level of the parser. */
+    std::string m_rootKey;                         /**< The last key read in the root object. */
+    std::string m_trackKey;                        /**< The last key read in the current track object. */
+    nlohmann::json m_settings;                     /**< The root fields other than users and tracks. */
+    nlohmann::json m_trackJson;                    /**< The fields of the current track other than articles. */
+    std::shared_ptr<Track> m_track;                /**< The current track, once created. */
+    bool m_trackFailed{false};                     /**< Whether the current track could not be created. */
+    std::vector<nlohmann::json> m_pendingArticles; /**< Articles read before the type of their track. */
+    nlohmann::json m_element;                      /**< The element being materialized. */
+    std::vector<nlohmann::json*> m_elementStack;   /**< The open containers of the element. */
+    std::string m_elementKey;                      /**< The last key read in the element. */
+};
+
+#endif // CONFERENCE_LOADER_HPP
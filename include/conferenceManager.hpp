@@ -10,7 +10,12 @@
 #define CONFERENCE_MANAGER_HPP
 
 #include "conference.hpp"
+#include "metrics.hpp"
+#include "phaseExecutor.hpp"
+#include <functional>
 #include <memory>
+#include <string_view>
+#include <thread>
 
 /**
  * @class ConferenceManager
@@ -18,7 +23,11 @@
  *
  * The ConferenceManager class provides functionalities to manage and control the
  * state transitions of tracks within a conference. It handles the initiation of
- * various phases such as bidding, revision, and selection for all tracks.
+ * various phases such as bidding, revision, and selection for all tracks. The bidding
+ * and review work of the tracks runs in parallel on a PhaseExecutor owned by the manager.
+ *
+ * Phase transitions and runs are timed into the Metrics of the process, per phase and per
+ * track, along with the bids and reviews generated by each track.
  */
 class ConferenceManager
 {
@@ -34,10 +43,13 @@ class ConferenceManager
     /**
      * @brief Parameterized constructor to initialize a ConferenceManager with a Conference object.
      * @param conference A shared pointer to a Conference object.
+     * @param threads The number of threads running the work of the tracks.
      *
      * Constructs a ConferenceManager object that manages the given Conference object.
      */
-    explicit ConferenceManager(std::shared_ptr<Conference> conference) : m_conference(conference)
+    explicit ConferenceManager(std::shared_ptr<Conference> conference,
+                               size_t threads = std::thread::hardware_concurrency())
+        : m_conference(conference), m_executor(threads)
     {
     }
 
@@ -75,6 +87,25 @@ class ConferenceManager
      */
     void startSelection(std::chrono::system_clock::time_point time);
 
+    /**
+     * @brief Runs the bidding of every track in the conference.
+     *
+     * The tracks bid in parallel. The bids the reviewers place on each track are buffered
+     * while the tracks run and appended to the reviewers afterwards, in track order, so
+     * the reviewers shared by several tracks are never written concurrently. Tracks must
+     * be in the bidding state, see startBidding.
+     */
+    void runBidding();
+
+    /**
+     * @brief Runs the review of every track in the conference.
+     *
+     * The tracks assign and collect their reviews in parallel, buffering the reviews of
+     * the reviewers as runBidding does. The assignment strategies are only read, so they
+     * may be shared between tracks. Tracks must be in the review state, see startRevision.
+     */
+    void runReview();
+
     /**
      * @brief Retrieves the shared pointer to the Conference object.
      * @return A shared pointer to the Conference object managed by this ConferenceManager.
@@ -84,7 +115,27 @@ class ConferenceManager
     std::shared_ptr<Conference> conference();
 
   private:
+    /**
+     * @brief Run a phase of every track in parallel.
+     * @param name The name of the phase, labelling its metrics.
+     * @param phase The work of the phase on a single track.
+     *
+     * Records the duration of the phase and of each track, the articles processed by each
+     * track and the growth of the heap over the phase.
+     */
+    void runPhase(std::string_view name, const std::function<void(Track&)>& phase);
+
+    /**
+     * @brief Get the histogram timing a phase.
+     * @param metric The name of the metric.
+     * @param phase The name of the phase.
+     * @param track The track, if the duration is the one of a single track.
+     * @return The histogram, or nullptr if the metrics are compiled out.
+     */
+    static Histogram* phaseTimer(std::string_view metric, std::string_view phase, const Track* track = nullptr);
+
     std::shared_ptr<Conference> m_conference; /**< Shared pointer to the Conference object being managed. */
+    PhaseExecutor m_executor;                 /**< Runs the work of the tracks in parallel. */
 };
 
 #endif // CONFERENCE_MANAGER_HPP
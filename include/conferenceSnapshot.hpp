@@ -0,0 +1,66 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFERENCE_SNAPSHOT_HPP
+#define CONFERENCE_SNAPSHOT_HPP
+
+#include "conference.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @class ConferenceSnapshot
+ * @brief Versioned binary snapshot of the state of a conference.
+ *
+ * The ConferenceSnapshot class saves a conference to a compact binary file and reopens
+ * it by mapping the file in memory. The file starts with a header holding a magic, the
+ * format version, the seed, the creation date and the offset and length of every section.
+ * The sections are a table of deduplicated strings, then fixed-width records for users,
+ * tracks, articles, authors, the reviewers of each track, the bids of each track as one
+ * byte per cell, and reviews with their reviewer, rating and confidence. Records refer to
+ * strings and to each other by index, so reloading reads them in place without any parsing
+ * and builds the users, articles and tables of each track directly from them, without
+ * replaying the submissions. The passwords of the users are not saved, so the snapshot
+ * holds no credentials and the restored users have none.
+ *
+ * A snapshot can be written at any phase boundary: the state of each track is saved
+ * with its articles, bids and reviews, and the aggregated scores are rebuilt from the
+ * reviews on load. Strategies are configuration rather than state and are not saved,
+ * nor are the histories kept by each Reviewer or the last selection, which the selection
+ * phase recomputes.
+ */
+class ConferenceSnapshot
+{
+  public:
+    static constexpr std::uint32_t VERSION = 2; /**< The version of the format written by this class. */
+
+    /**
+     * @brief Write a snapshot of a conference.
+     * @param conference The conference to save.
+     * @param path The path of the snapshot file.
+     *
+     * The snapshot is written to a temporary file, flushed to disk and renamed over the
+     * path once complete, then the directory is flushed, so neither an interrupted write
+     * nor a power loss leaves a truncated snapshot behind. Throws a runtime_error if the
+     * file cannot be written.
+     */
+    static void write(const Conference& conference, const std::string& path);
+
+    /**
+     * @brief Load a conference from a snapshot.
+     * @param path The path of the snapshot file.
+     * @return A shared pointer to the restored conference.
+     *
+     * Throws a runtime_error if the file cannot be mapped, was written by another
+     * version of the format, or holds out of range records.
+     */
+    static std::shared_ptr<Conference> load(const std::string& path);
+};
+
+#endif // CONFERENCE_SNAPSHOT_HPP
@@ -0,0 +1,104 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFLICT_INDEX_HPP
+#define CONFLICT_INDEX_HPP
+
+#include "articleInterface.hpp"
+#include "conflictMask.hpp"
+#include "user.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ConflictIndex
+ * @brief Affiliations of the people of a conference, for detecting conflicts of interest.
+ *
+ * The ConflictIndex class maps the name of every registered user to its affiliation, each
+ * affiliation being interned to a dense integer id. Names are keyed by their 64-bit hash in a
+ * flat open-addressing table, so a lookup hashes the name once and probes contiguous slots,
+ * only comparing the name itself in the slots holding the same hash. A reviewer is in conflict with an article
+ * when one of its authors shares the affiliation of the reviewer, which includes the reviewer
+ * being one of the authors.
+ *
+ * The mask groups the reviewers of a track by affiliation, so building it costs one lookup per
+ * author and one bit per conflicting author affiliation, and the assignment then only tests bits.
+ */
+class ConflictIndex
+{
+  public:
+    /**
+     * @brief Register the affiliation of a user.
+     * @param user The user, author or reviewer.
+     * @return False if the name is already registered under another affiliation, true otherwise.
+     *
+     * People are told apart by their name only, so a second user with the same name and another affiliation
+     * is not registered: the earlier affiliation is kept, and the caller reports the duplicate.
+     */
+    bool addUser(const User& user);
+
+    /**
+     * @brief Get the number of registered users.
+     * @return The number of distinct names.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Compute the conflicts of interest of a track.
+     * @param mask The mask receiving the conflicts, reset to the size of the track. The reviewers are grouped in
+     * memory from the resource of the mask.
+     * @param articles The articles of the track to assign, the mask following their order.
+     * @param reviewers The reviewers of the track.
+     * @return The number of reviewer and article pairs masked.
+     */
+    size_t mask(ConflictMask& mask, std::span<const std::shared_ptr<Article>> articles,
+                const std::vector<std::shared_ptr<User>>& reviewers) const;
+
+  private:
+    /** The id of an unknown affiliation. */
+    static constexpr auto NO_AFFILIATION = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @struct Person
+     * @brief A slot of the table of the registered users.
+     */
+    struct Person
+    {
+        std::uint64_t hash{0};                     /**< The hash of the name of the user. */
+        std::uint32_t name{0};                     /**< The position of the name of the user among the names. */
+        std::uint32_t affiliation{NO_AFFILIATION}; /**< The affiliation id, NO_AFFILIATION for a free slot. */
+    };
+
+    /**
+     * @brief Find the slot of a user.
+     * @param hash The hash of the name of the user.
+     * @param name The name of the user, compared in the slots holding the same hash.
+     * @return The slot holding the user, or the free slot ending its probe sequence.
+     */
+    size_t slotOf(std::uint64_t hash, std::string_view name) const;
+
+    /**
+     * @brief Find the affiliation id of a user.
+     * @param name The name of the user.
+     * @return The id of its affiliation, or NO_AFFILIATION if the user is not registered.
+     */
+    std::uint32_t affiliationOf(const std::string& name) const;
+
+    std::unordered_map<std::string, std::uint32_t> m_affiliations; /**< The id of each affiliation. */
+    std::vector<Person> m_people;                                  /**< The users, by hash of their name. */
+    std::vector<std::string> m_names;                              /**< The names of the users, in order added. */
+};
+
+#endif // CONFLICT_INDEX_HPP
@@ -0,0 +1,113 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFLICT_MASK_HPP
+#define CONFLICT_MASK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+/**
+ * @class ConflictMask
+ * @brief Dense bitset of the reviewer and article pairs that must not be assigned.
+ *
+ * The ConflictMask class groups the reviewers of a track, typically by affiliation, and keeps
+ * one bit per article and group, set when every reviewer of the group has a conflict of
+ * interest with the article. Bits are stored article-major, as in the BidMatrix, so the
+ * assignment strategies test a pair with a lookup of the group of the reviewer, a shift and
+ * a mask while they walk the bids of an article. An empty mask holds no conflict.
+ *
+ * Masking a group rather than each of its reviewers keeps the mask small and building it
+ * cheap, while the number of masked pairs is still counted per reviewer.
+ *
+ * A mask lives as long as the review phase that builds it, so it may allocate its bits from
+ * the arena of the phase rather than from the heap.
+ */
+class ConflictMask
+{
+  public:
+    /** The group of a reviewer that cannot be in conflict. */
+    static constexpr auto NO_GROUP = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty mask, in which no pair is in conflict.
+     */
+    ConflictMask() = default;
+
+    /**
+     * @brief Constructor allocating from a memory resource.
+     * @param resource The resource the mask allocates from, which must outlive it.
+     *
+     * Initializes an empty mask, in which no pair is in conflict.
+     */
+    explicit ConflictMask(std::pmr::memory_resource* resource);
+
+    /**
+     * @brief Resize the mask and clear every conflict.
+     * @param reviewerGroups The group of each reviewer, by reviewer id, or NO_GROUP.
+     * @param groups The number of groups, every group of a reviewer being lower.
+     * @param articles The number of articles.
+     */
+    void reset(std::span<const std::uint32_t> reviewerGroups, size_t groups, size_t articles);
+
+    /**
+     * @brief Mark an article as in conflict with every reviewer of a group.
+     * @param group The group.
+     * @param article The position of the article in the track.
+     * @return True if the article was not in conflict with the group yet.
+     */
+    bool set(std::uint32_t group, size_t article);
+
+    /**
+     * @brief Check whether a pair is in conflict.
+     * @param reviewer The position of the reviewer in the track.
+     * @param article The position of the article in the track.
+     * @return True if the reviewer must not review the article.
+     */
+    bool conflicted(size_t reviewer, size_t article) const
+    {
+        if (m_bits.empty() || m_groups[reviewer] == NO_GROUP)
+        {
+            return false;
+        }
+        const auto index = article * m_groupSizes.size() + m_groups[reviewer];
+        return ((m_bits[index / 64] >> (index % 64)) & 1U) != 0;
+    }
+
+    /**
+     * @brief Get the number of pairs in conflict.
+     * @return The number of reviewer and article pairs masked.
+     */
+    size_t count() const;
+
+    /**
+     * @brief Check whether the mask holds any pair.
+     * @return True if there are no cells, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the memory resource of the mask.
+     * @return The resource the mask allocates from.
+     */
+    std::pmr::memory_resource* resource() const;
+
+  private:
+    std::pmr::vector<std::uint32_t> m_groups;     /**< The group of each reviewer. */
+    std::pmr::vector<std::uint32_t> m_groupSizes; /**< The number of reviewers of each group. */
+    size_t m_count{0};                            /**< The number of pairs in conflict. */
+    std::pmr::vector<std::uint64_t> m_bits;       /**< One bit per article and group, article-major. */
+};
+
+#endif // CONFLICT_MASK_HPP
@@ -0,0 +1,30 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef IDENTIFIERS_HPP
+#define IDENTIFIERS_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Dense identifier of an article within a track.
+ *
+ * Articles receive consecutive ids starting at zero when they are submitted to a track,
+ * and every per-article table of the track is a vector indexed by this id.
+ */
+using ArticleId = std::uint32_t;
+
+/**
+ * @brief Dense identifier of a reviewer within a track.
+ *
+ * Reviewers receive consecutive ids starting at zero when they join a track, and every
+ * per-reviewer table of the track is a vector indexed by this id.
+ */
+using ReviewerId = std::uint32_t;
+
+#endif // IDENTIFIERS_HPP
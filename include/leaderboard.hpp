@@ -0,0 +1,158 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef LEADERBOARD_HPP
+#define LEADERBOARD_HPP
+
+#include "identifiers.hpp"
+#include "review.hpp"
+#include "reviewAggregate.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Leaderboard
+ * @brief Live ranking of the articles of a track, kept up to date as reviews arrive.
+ *
+ * The Leaderboard class holds the aggregated reviews of each article, indexed by article id,
+ * along with two order-statistics structures maintained on every review: a Fenwick tree
+ * counting the reviewed articles of each score key, and an ordered set of the reviewed
+ * articles by descending score key and ascending id.
+ *
+ * Adding a review costs O(log N). Counting the articles at or above a score and the rank of
+ * an article cost O(log L), L being the few thousand possible score keys, and reading the k
+ * best articles costs O(k), so selections read the ranking instead of rebuilding it.
+ */
+class Leaderboard
+{
+  public:
+    /** The lowest possible score key. */
+    static constexpr std::int32_t LOWEST_KEY = static_cast<int>(Rating::NotRecommended) * ReviewAggregate::SCORE_SCALE;
+
+    /** The highest possible score key. */
+    static constexpr std::int32_t HIGHEST_KEY = static_cast<int>(Rating::Excellent) * ReviewAggregate::SCORE_SCALE;
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes a leaderboard with no articles.
+     */
+    Leaderboard();
+
+    /**
+     * @brief Set the number of articles.
+     * @param articles The number of articles.
+     *
+     * New articles are unreviewed. Articles beyond the new size are dropped from the ranking.
+     */
+    void resize(std::size_t articles);
+
+    /**
+     * @brief Drop every article and every review.
+     */
+    void clear();
+
+    /**
+     * @brief Fold a review into the score of an article and move the article in the ranking.
+     * @param article The id of the reviewed article, lower than size.
+     * @param review The review.
+     * @return The new aggregated reviews of the article.
+     */
+    const ReviewAggregate& add(ArticleId article, const Review& review);
+
+    /**
+     * @brief Fold a rating into the score of an article and move the article in the ranking.
+     * @param article The id of the reviewed article, lower than size.
+     * @param rating The rating of the review.
+     * @param confidence The confidence of the reviewer on the rating.
+     * @return The new aggregated reviews of the article.
+     */
+    const ReviewAggregate& add(ArticleId article, Rating rating, Confidence confidence);
+
+    /**
+     * @brief Get the number of articles.
+     * @return The number of articles, reviewed or not.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Check whether the leaderboard holds any article.
+     * @return True if there are no articles.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the aggregated reviews of an article.
+     * @param article The id of the article, lower than size.
+     * @return The aggregated reviews, empty if the article is unreviewed.
+     */
+    const ReviewAggregate& operator[](ArticleId article) const;
+
+    /**
+     * @brief Get the aggregated reviews of every article.
+     * @return The aggregated reviews, indexed by article id.
+     */
+    std::span<const ReviewAggregate> scores() const;
+
+    /**
+     * @brief Get the number of reviewed articles.
+     * @return The number of articles holding at least one review.
+     */
+    std::size_t reviewed() const;
+
+    /**
+     * @brief Count the reviewed articles scoring at least a given score key.
+     * @param scoreKey The score key.
+     * @return The number of reviewed articles whose score key is at least scoreKey.
+     */
+    std::size_t atOrAbove(std::int32_t scoreKey) const;
+
+    /**
+     * @brief Get the rank of an article.
+     * @param article The id of the article.
+     * @return One plus the number of articles scoring strictly better, or 0 if the article is unreviewed.
+     *
+     * Articles with the same score share their rank.
+     */
+    std::size_t rank(ArticleId article) const;
+
+    /**
+     * @brief Read the best articles.
+     * @param count The number of articles to read.
+     * @param articles The vector receiving the ids, by descending score and ascending id.
+     *
+     * Reads the count best reviewed articles, or every reviewed article if there are fewer,
+     * reusing the storage of articles.
+     */
+    void top(std::size_t count, std::vector<ArticleId>& articles) const;
+
+  private:
+    /**
+     * @brief Add to the number of articles of a score key.
+     * @param scoreKey The score key.
+     * @param delta The number of articles to add, negative to remove.
+     */
+    void count(std::int32_t scoreKey, std::int32_t delta);
+
+    /**
+     * @brief Count the reviewed articles scoring below a given score key.
+     * @param scoreKey The score key, between LOWEST_KEY and HIGHEST_KEY + 1.
+     * @return The number of reviewed articles whose score key is lower than scoreKey.
+     */
+    std::size_t below(std::int32_t scoreKey) const;
+
+    std::vector<ReviewAggregate> m_scores;                  /**< The aggregated reviews, by article id. */
+    std::set<std::pair<std::int32_t, ArticleId>> m_ranking; /**< The reviewed articles, by negated score key and id. */
+    std::vector<std::int32_t> m_levels;                     /**< Fenwick tree of the articles of each score key. */
+};
+
+#endif // LEADERBOARD_HPP
@@ -0,0 +1,274 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef COMFY_CHAIR_NO_METRICS
+inline constexpr bool METRICS_ENABLED = false; /**< Whether the instrumentation is compiled in. */
+#else
+inline constexpr bool METRICS_ENABLED = true; /**< Whether the instrumentation is compiled in. */
+#endif
+
+/** The labels of a series, as name and value pairs, such as the track and the phase. */
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @class Counter
+ * @brief Monotonic counter of a metric series.
+ *
+ * Counters are incremented with relaxed atomics, so any thread may add to them without locking.
+ */
+class Counter
+{
+  public:
+    /**
+     * @brief Increment the counter.
+     * @param amount The amount to add.
+     */
+    void add(std::uint64_t amount = 1)
+    {
+        if constexpr (METRICS_ENABLED)
+        {
+            m_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Get the value of the counter.
+     * @return The sum of every amount added since the last reset.
+     */
+    std::uint64_t value() const;
+
+    /**
+     * @brief Set the counter back to zero.
+     */
+    void reset();
+
+  private:
+    std::atomic<std::uint64_t> m_value{0}; /**< The value of the counter. */
+};
+
+/**
+ * @class Gauge
+ * @brief Last observed value of a metric series, which may go down.
+ */
+class Gauge
+{
+  public:
+    /**
+     * @brief Set the value of the gauge.
+     * @param value The observed value.
+     */
+    void set(double value);
+
+    /**
+     * @brief Get the value of the gauge.
+     * @return The last observed value, 0 if none was.
+     */
+    double value() const;
+
+    /**
+     * @brief Set the gauge back to zero.
+     */
+    void reset();
+
+  private:
+    std::atomic<double> m_value{0.0}; /**< The last observed value. */
+};
+
+/**
+ * @class Histogram
+ * @brief Distribution of the durations of a metric series, in seconds.
+ *
+ * The buckets grow tenfold from a microsecond to 100 seconds, which covers a rejected
+ * operation as well as the bidding of a large track. Observations only touch atomics.
+ */
+class Histogram
+{
+  public:
+    /** The upper bounds of the buckets, in seconds, the last bucket holding everything above. */
+    static constexpr std::array<double, 9> BOUNDS{1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1.0, 10.0, 100.0};
+
+    /**
+     * @brief Record an observation.
+     * @param seconds The observed duration.
+     */
+    void observe(double seconds);
+
+    /**
+     * @brief Get the number of observations.
+     * @return The number of observations since the last reset.
+     */
+    std::uint64_t count() const;
+
+    /**
+     * @brief Get the sum of the observations.
+     * @return The total of the observed durations, in seconds.
+     */
+    double sum() const;
+
+    /**
+     * @brief Get the number of observations up to a bound.
+     * @param bound The index of the bound in BOUNDS, or BOUNDS.size() for every observation.
+     * @return The number of observations lower or equal to the bound.
+     */
+    std::uint64_t cumulative(std::size_t bound) const;
+
+    /**
+     * @brief Clear every observation.
+     */
+    void reset();
+
+  private:
+    std::array<std::atomic<std::uint64_t>, BOUNDS.size() + 1> m_buckets{}; /**< The observations of each bucket. */
+    std::atomic<double> m_sum{0.0};                                        /**< The sum of the observations. */
+};
+
+/**
+ * @class ScopedTimer
+ * @brief Records the lifetime of a scope into a histogram.
+ */
+class ScopedTimer
+{
+  public:
+    /**
+     * @brief Start the timer.
+     * @param histogram The histogram receiving the duration, or nullptr to record nothing.
+     */
+    explicit ScopedTimer(Histogram* histogram);
+
+    /**
+     * @brief Stop the timer and record the elapsed time.
+     */
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    Histogram* m_histogram;                        /**< The histogram receiving the duration. */
+    std::chrono::steady_clock::time_point m_start; /**< When the timer started. */
+};
+
+/**
+ * @class Metrics
+ * @brief Registry of the counters, gauges and histograms of the process.
+ *
+ * The Metrics class owns every metric series, identified by a name and its labels, and
+ * exports them as JSON or in the Prometheus text format. Looking a series up takes a lock,
+ * so instrumented code looks its series up once per track or phase and keeps the reference,
+ * which stays valid for the lifetime of the registry; recording into a series is lock-free.
+ *
+ * Instrumentation points test METRICS_ENABLED, which is false when the build defines
+ * COMFY_CHAIR_NO_METRICS, so a build without metrics neither looks series up nor records.
+ */
+class Metrics
+{
+  public:
+    /**
+     * @brief Get the registry of the process.
+     * @return The registry every instrumentation point records into.
+     */
+    static Metrics& global();
+
+    /**
+     * @brief Get a counter, creating it on first use.
+     * @param name The name of the metric.
+     * @param labels The labels of the series.
+     * @return The counter of the series.
+     */
+    Counter& counter(std::string_view name, const MetricLabels& labels = {});
+
+    /**
+     * @brief Get a gauge, creating it on first use.
+     * @param name The name of the metric.
+     * @param labels The labels of the series.
+     * @return The gauge of the series.
+     */
+    Gauge& gauge(std::string_view name, const MetricLabels& labels = {});
+
+    /**
+     * @brief Get a histogram, creating it on first use.
+     * @param name The name of the metric.
+     * @param labels The labels of the series.
+     * @return The histogram of the series.
+     */
+    Histogram& histogram(std::string_view name, const MetricLabels& labels = {});
+
+    /**
+     * @brief Set every series back to zero, keeping the series and their references.
+     */
+    void reset();
+
+    /**
+     * @brief Export every series as a JSON document.
+     * @param output The stream receiving the document.
+     *
+     * The document holds the "counters", "gauges" and "histograms" arrays, each series
+     * giving its name, labels and values.
+     */
+    void writeJson(std::ostream& output) const;
+
+    /**
+     * @brief Export every series in the Prometheus text exposition format.
+     * @param output The stream receiving the metrics.
+     */
+    void writePrometheus(std::ostream& output) const;
+
+    /**
+     * @brief Export every series to a file.
+     * @param path The path of the file, written as JSON if it ends with ".json", as Prometheus text otherwise.
+     *
+     * Throws an invalid_argument exception if the file cannot be written.
+     */
+    void write(const std::string& path) const;
+
+    /**
+     * @brief Get the number of bytes allocated on the heap by the process.
+     * @return The bytes in use reported by the allocator, mapped blocks included, or 0 where it does
+     * not report them.
+     */
+    static std::size_t heapInUse();
+
+  private:
+    /** The series of every metric of a kind, by name then labels. */
+    template <typename Series>
+    using Families = std::map<std::string, std::map<MetricLabels, std::unique_ptr<Series>>, std::less<>>;
+
+    /**
+     * @brief Get the series of a family, creating it on first use.
+     * @param family The series of a metric, by labels.
+     * @param labels The labels of the series.
+     * @return The series.
+     */
+    template <typename Series>
+    static Series& series(std::map<MetricLabels, std::unique_ptr<Series>>& family, const MetricLabels& labels);
+
+    mutable std::mutex m_mutex;       /**< Guards the creation of series. */
+    Families<Counter> m_counters;     /**< The counters. */
+    Families<Gauge> m_gauges;         /**< The gauges. */
+    Families<Histogram> m_histograms; /**< The histograms. */
+};
+
+#endif // METRICS_HPP
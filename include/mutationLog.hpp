@@ -0,0 +1,241 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef MUTATION_LOG_HPP
+#define MUTATION_LOG_HPP
+
+#include "articleInterface.hpp"
+#include "bidMatrix.hpp"
+#include "itrackState.hpp"
+#include "review.hpp"
+#include "reviewStore.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+class Conference;
+
+/**
+ * @class MutationLog
+ * @brief Append-only write-ahead log of the mutations of a conference.
+ *
+ * The MutationLog class records the changes made to the tracks of a conference since
+ * it was loaded, so they survive a crash: article submissions, updates and deletions,
+ * the bids that changed in each bidding phase, every review with its reviewer, and the
+ * state transitions of the tracks.
+ * Each record is framed with its length and a CRC-32 of its content.
+ *
+ * Records are made durable by group commit. Callers append records to a shared buffer
+ * and wait; a single flusher thread writes everything appended so far and syncs the file
+ * once for the whole batch, then wakes the callers it covered. Concurrent submitters thus
+ * share the cost of each sync instead of paying one each. A commit delay lets the flusher
+ * wait a little for more records before syncing, trading latency for throughput.
+ *
+ * On startup, the conference is loaded from its last snapshot or document, the log is
+ * replayed on top of it with replay, and a new MutationLog is opened to keep appending.
+ */
+class MutationLog
+{
+  public:
+    /**
+     * @brief Open a log for appending, creating the file if needed.
+     * @param path The path of the log file.
+     * @param commitDelay How long the flusher waits for more records before syncing a batch.
+     *
+     * Throws a runtime_error if the file cannot be opened.
+     */
+    explicit MutationLog(const std::string& path, std::chrono::microseconds commitDelay = {});
+
+    /**
+     * @brief Destructor, syncing the records appended so far.
+     */
+    ~MutationLog();
+
+    MutationLog(const MutationLog&) = delete;
+    MutationLog& operator=(const MutationLog&) = delete;
+
+    /**
+     * @brief Append a record without waiting for it to be durable.
+     * @param record The content of the record.
+     * @return The sequence number of the record, to pass to commit.
+     */
+    std::uint64_t append(const std::string& record);
+
+    /**
+     * @brief Wait until a record and every record before it are durable.
+     * @param sequence The sequence number returned by append.
+     *
+     * Throws a runtime_error if the log could not be written.
+     */
+    void commit(std::uint64_t sequence);
+
+    /**
+     * @brief Append a record and wait until it is durable.
+     * @param record The content of the record.
+     */
+    void log(const std::string& record);
+
+    /**
+     * @brief Discard every record, once a snapshot holds their effect.
+     *
+     * Waits for the records appended so far to be written before truncating the file.
+     */
+    void truncate();
+
+    /**
+     * @brief Get the number of syncs made so far.
+     * @return The number of batches written to the file.
+     */
+    std::uint64_t syncs() const;
+
+    /**
+     * @brief Replay a log on top of a conference.
+     * @param path The path of the log file.
+     * @param conference The conference, as loaded when the log was opened.
+     * @return The number of records replayed.
+     *
+     * Replays the records in order, resolving tracks by their position in the conference.
+     * A record cut short by a crash ends the replay and is removed from the file, so the
+     * log can be reopened for appending. A missing file replays nothing. Throws a
+     * runtime_error if a complete record does not match the conference.
+     */
+    static size_t replay(const std::string& path, Conference& conference);
+
+  private:
+    /**
+     * @brief Write and sync the pending records until the log is closed.
+     */
+    void flush();
+
+    int m_descriptor{-1};              /**< The descriptor of the log file. */
+    std::chrono::microseconds m_delay; /**< The time the flusher waits to gather a batch. */
+    mutable std::mutex m_mutex;        /**< Protects the fields below. */
+    std::condition_variable m_pending; /**< Signaled when records are appended. */
+    std::condition_variable m_durable; /**< Signaled when a batch is synced. */
+    std::string m_buffer;              /**< The framed records waiting to be written. */
+    std::uint64_t m_appended{0};       /**< The sequence number of the last appended record. */
+    std::uint64_t m_synced{0};         /**< The sequence number of the last durable record. */
+    std::uint64_t m_syncs{0};          /**< The number of batches synced. */
+    bool m_stopping{false};            /**< Whether the log is being closed. */
+    std::string m_error;               /**< The error that stopped the flusher, if any. */
+    std::thread m_flusher;             /**< The thread writing the batches. */
+};
+
+/**
+ * @class TrackJournal
+ * @brief Handle through which a track records its mutations in a MutationLog.
+ *
+ * A TrackJournal identifies the track by its position in the conference. A default
+ * constructed journal is detached and records nothing, which is how tracks start.
+ */
+class TrackJournal
+{
+  public:
+    /**
+     * @brief Default constructor, creating a detached journal.
+     */
+    TrackJournal() = default;
+
+    /**
+     * @brief Create a journal for a track.
+     * @param log The log to record the mutations in.
+     * @param track The position of the track in the conference.
+     */
+    TrackJournal(std::shared_ptr<MutationLog> log, std::uint32_t track);
+
+    /**
+     * @brief Record an operation on an article, once the track applied it.
+     * @param article The article.
+     * @param operation The operation.
+     * @param result The outcome of the operation; a rejected operation is not recorded.
+     *
+     * Only the operations the track applied are recorded, so replaying the log never meets
+     * an operation it would reject again.
+     */
+    void article(const Article& article, OperationType operation, const TrackResult& result = {}) const;
+
+    /**
+     * @brief Record an operation on a batch of articles, once the track applied it.
+     * @param articles The articles.
+     * @param results The outcome of each article; the rejected ones are not recorded.
+     * @param operation The operation.
+     *
+     * Records one operation per article, and waits for all of them to be durable at once.
+     */
+    void articles(std::span<const std::shared_ptr<Article>> articles, std::span<const TrackResult> results,
+                  OperationType operation) const;
+
+    /**
+     * @brief Record the bids placed by the bidding phase.
+     * @param previous The bids of the track before the phase.
+     * @param bids The bids of the track after the phase.
+     *
+     * Only the cells that changed are recorded, every cell of a matrix of new dimensions being compared to
+     * no bid, so the record grows with the bids placed rather than with the matrix. Nothing is recorded
+     * when no bid changed.
+     */
+    void bids(const BidMatrix& previous, const BidMatrix& bids) const;
+
+    /**
+     * @brief Record the reviews written by the review phase.
+     * @param reviews The reviews of the track.
+     * @param first The position in the store of the first review written by the phase.
+     *
+     * Records one review per record, with its reviewer, and waits for all of them to be durable at once.
+     * The reviews the store held before the phase are already in the log.
+     */
+    void reviews(const ReviewStore& reviews, std::uint32_t first) const;
+
+    /**
+     * @brief Record one review submitted to an article.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     *
+     * The review is recorded without a reviewer, as the track stores it.
+     */
+    void review(ArticleId article, const Review& review) const;
+
+    /**
+     * @brief Record a state transition.
+     * @param state The name of the new state.
+     */
+    void state(std::string_view state) const;
+
+  private:
+    /**
+     * @brief Encode an operation on an article.
+     * @param article The article.
+     * @param operation The operation.
+     * @return The content of the record.
+     */
+    std::string articleRecord(const Article& article, OperationType operation) const;
+
+    /**
+     * @brief Encode a review.
+     * @param reviewer The id of the reviewer, or ReviewStore::NO_REVIEWER.
+     * @param article The id of the reviewed article.
+     * @param text The text of the review.
+     * @param rating The rating of the review.
+     * @param confidence The confidence of the review.
+     * @return The content of the record.
+     */
+    std::string reviewRecord(ReviewerId reviewer, ArticleId article, std::string_view text, Rating rating,
+                             Confidence confidence) const;
+
+    std::shared_ptr<MutationLog> m_log; /**< The log, or null when detached. */
+    std::uint32_t m_track{0};           /**< The position of the track in the conference. */
+};
+
+#endif // MUTATION_LOG_HPP
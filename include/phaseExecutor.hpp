@@ -0,0 +1,94 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef PHASE_EXECUTOR_HPP
+#define PHASE_EXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class PhaseExecutor
+ * @brief Fixed pool of threads that runs the work of a conference phase in parallel.
+ *
+ * The PhaseExecutor class runs a batch of independent tasks, such as the bidding of every
+ * track of a conference, on a pool of threads started once and reused for every phase.
+ * Each call to run is a fork-join: the tasks are claimed one at a time from a shared
+ * counter by the workers and by the calling thread, so a slow track never holds back
+ * the others, and the call returns once every task has finished.
+ */
+class PhaseExecutor
+{
+  public:
+    /**
+     * @brief Parameterized constructor to initialize the pool.
+     * @param threads The number of threads running the tasks, including the calling thread.
+     *
+     * Starts threads - 1 workers, since the thread calling run takes part in the work.
+     * A value of 0 or 1 runs every task on the calling thread.
+     */
+    explicit PhaseExecutor(size_t threads = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Destructor.
+     *
+     * Stops and joins the workers.
+     */
+    ~PhaseExecutor();
+
+    PhaseExecutor(const PhaseExecutor&) = delete;
+    PhaseExecutor& operator=(const PhaseExecutor&) = delete;
+
+    /**
+     * @brief Get the number of threads running the tasks.
+     * @return The number of workers plus the calling thread.
+     */
+    size_t threads() const;
+
+    /**
+     * @brief Run a batch of tasks and wait for all of them.
+     * @param tasks The number of tasks.
+     * @param task The work to perform, called once with every index in [0, tasks).
+     *
+     * The tasks may run in any order and on any thread. If a task throws, the remaining
+     * tasks still run and the first exception is rethrown once all of them are done.
+     * Batches must not be nested: a task must not call run on the same executor.
+     */
+    void run(size_t tasks, const std::function<void(size_t)>& task);
+
+  private:
+    /**
+     * @brief Loop of a worker thread, running every batch until the executor stops.
+     */
+    void work();
+
+    /**
+     * @brief Claim and run tasks of the current batch until none is left.
+     */
+    void drain();
+
+    std::vector<std::thread> m_workers;          /**< The worker threads. */
+    std::mutex m_mutex;                          /**< Guards the batch hand-off between threads. */
+    std::condition_variable m_wake;              /**< Signals the workers that a batch started or the pool stops. */
+    std::condition_variable m_done;              /**< Signals the calling thread that the workers finished. */
+    const std::function<void(size_t)>* m_task{}; /**< The work of the current batch. */
+    size_t m_tasks{0};                           /**< The number of tasks in the current batch. */
+    std::atomic<size_t> m_next{0};               /**< The index of the next task to claim. */
+    size_t m_busy{0};                            /**< The number of workers still in the current batch. */
+    std::uint64_t m_batch{0};                    /**< The number of batches started so far. */
+    bool m_stopping{false};                      /**< Whether the workers must exit. */
+    std::exception_ptr m_error;                  /**< The first exception thrown by a task of the batch. */
+};
+
+#endif // PHASE_EXECUTOR_HPP
@@ -0,0 +1,82 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef RANDOM_STREAM_HPP
+#define RANDOM_STREAM_HPP
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @class RandomStream
+ * @brief Counter-based random number stream built on the Philox4x32-10 generator.
+ *
+ * The RandomStream class derives its numbers from a key and a counter instead of from
+ * a mutable engine state: the n-th number of a stream is a pure function of the key,
+ * the stream id, the domain and n. Any draw can therefore be recomputed on any thread,
+ * in any order, so simulations keyed by what they model, such as a reviewer and an
+ * article, give identical results however the work is split between threads.
+ */
+class RandomStream
+{
+  public:
+    using Block = std::array<std::uint32_t, 4>; /**< Four words produced by a single Philox call. */
+
+    /**
+     * @brief Parameterized constructor to open a stream.
+     * @param key The key of the stream, usually derived from a seed with mix.
+     * @param stream The id of the stream under the key.
+     * @param domain Separates streams with the same key and id drawn for different purposes.
+     */
+    RandomStream(std::uint64_t key, std::uint64_t stream, std::uint32_t domain = 0);
+
+    /**
+     * @brief Draw the next 32-bit word of the stream.
+     * @return A uniformly distributed 32-bit value.
+     */
+    std::uint32_t next();
+
+    /**
+     * @brief Draw an integer uniformly in [0, bound).
+     * @param bound The exclusive upper bound, which must be positive.
+     * @return An unbiased value lower than bound.
+     */
+    std::uint32_t uniform(std::uint32_t bound);
+
+    /**
+     * @brief Apply the Philox4x32-10 bijection.
+     * @param counter The counter to encrypt.
+     * @param key The key, split in two 32-bit words.
+     * @return The four random words of the counter.
+     */
+    static Block philox(Block counter, std::uint64_t key);
+
+    /**
+     * @brief Combine two values into a well distributed key.
+     * @param first The first value, typically a seed.
+     * @param second The second value, typically the hash of an identity.
+     * @return A 64-bit key depending on both values.
+     */
+    static std::uint64_t mix(std::uint64_t first, std::uint64_t second);
+
+    /**
+     * @brief Hash a text into a stable 64-bit value.
+     * @param text The text to hash.
+     * @return The FNV-1a hash of the text, identical on every platform and run.
+     */
+    static std::uint64_t hash(std::string_view text);
+
+  private:
+    std::uint64_t m_key; /**< The key of the stream. */
+    Block m_counter;     /**< The counter of the next block, its first word being the block index. */
+    Block m_block{};     /**< The words of the current block. */
+    size_t m_used{4};    /**< The number of words of the current block already drawn. */
+};
+
+#endif // RANDOM_STREAM_HPP
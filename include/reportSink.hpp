@@ -0,0 +1,78 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REPORT_SINK_HPP
+#define REPORT_SINK_HPP
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <variant>
+
+/**
+ * @brief Value of a field of a report, either text or an integer.
+ */
+using ReportValue = std::variant<std::string_view, std::int64_t>;
+
+/**
+ * @struct ReportField
+ * @brief Named value reported with an event.
+ */
+struct ReportField
+{
+    std::string_view name; /**< The name of the field, used by structured sinks. */
+    ReportValue value;     /**< The value of the field. */
+};
+
+/**
+ * @class ReportSink
+ * @brief Abstract base class for the destinations of the messages of the conference.
+ *
+ * The ReportSink class receives every message printed by the conference, its tracks
+ * and their states as an event name, a text format and the fields of the event. Text
+ * sinks substitute the fields into the "{}" placeholders of the format, in order, while
+ * structured sinks write the event and the named fields and ignore the format. Sinks
+ * may be shared by tracks running in parallel, so implementations must be thread safe
+ * and write each report in one piece.
+ */
+class ReportSink
+{
+  public:
+    /**
+     * @brief Virtual destructor.
+     *
+     * Ensures proper cleanup of derived classes.
+     */
+    virtual ~ReportSink() = default;
+
+    /**
+     * @brief Report an event.
+     * @param event The name of the event.
+     * @param format The text of the event, with a "{}" placeholder for each field.
+     * @param fields The fields of the event, in the order of the placeholders.
+     *
+     * This pure virtual method must be implemented by derived classes to write or drop the report.
+     */
+    virtual void report(std::string_view event, std::string_view format, std::initializer_list<ReportField> fields) = 0;
+
+    /**
+     * @brief Write out the reports buffered so far.
+     *
+     * This pure virtual method must be implemented by derived classes that buffer their reports.
+     */
+    virtual void flush() = 0;
+
+    /**
+     * @brief Get the sink used unless another one is given.
+     * @return The sink writing the reports as text to the standard output, line by line.
+     */
+    static const std::shared_ptr<ReportSink>& standard();
+};
+
+#endif // REPORT_SINK_HPP
@@ -0,0 +1,66 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REPORT_SINK_JSON_HPP
+#define REPORT_SINK_JSON_HPP
+
+#include "reportSink.hpp"
+#include <mutex>
+#include <ostream>
+#include <string>
+
+/**
+ * @class ReportSinkJson
+ * @brief Report sink writing one JSON object per line to a stream.
+ *
+ * The ReportSinkJson class writes each report as a JSON object holding the name of
+ * the event under "event" and every field under its name, so the output of a run can
+ * be processed by other tools. Reports are buffered as in ReportSinkText.
+ */
+class ReportSinkJson : public ReportSink
+{
+  public:
+    /**
+     * @brief Create a sink writing to a stream.
+     * @param output The stream, which must outlive the sink.
+     * @param bufferSize The number of bytes gathered before writing them to the stream.
+     */
+    explicit ReportSinkJson(std::ostream& output, size_t bufferSize = 0);
+
+    /**
+     * @brief Destructor, writing out the buffered reports.
+     */
+    ~ReportSinkJson() override;
+
+    /**
+     * @brief Write a report as a JSON object.
+     * @param event The name of the event.
+     * @param format The text of the event, not written.
+     * @param fields The fields of the event.
+     */
+    void report(std::string_view event, std::string_view format, std::initializer_list<ReportField> fields) override;
+
+    /**
+     * @brief Write the buffered reports to the stream and flush it.
+     */
+    void flush() override;
+
+  private:
+    /**
+     * @brief Append a JSON string to the buffer.
+     * @param text The text of the string, escaped as needed.
+     */
+    void quote(std::string_view text);
+
+    std::ostream& m_output; /**< The stream the reports are written to. */
+    size_t m_bufferSize;    /**< The number of bytes gathered before writing them. */
+    std::string m_buffer;   /**< The reports not yet written. */
+    std::mutex m_mutex;     /**< Serializes the reports of concurrent tracks. */
+};
+
+#endif // REPORT_SINK_JSON_HPP
@@ -0,0 +1,38 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REPORT_SINK_NULL_HPP
+#define REPORT_SINK_NULL_HPP
+
+#include "reportSink.hpp"
+
+/**
+ * @class ReportSinkNull
+ * @brief Report sink dropping every report.
+ *
+ * The ReportSinkNull class disables the output of the conference, for runs where only
+ * the results matter.
+ */
+class ReportSinkNull : public ReportSink
+{
+  public:
+    /**
+     * @brief Drop a report.
+     * @param event The name of the event.
+     * @param format The text of the event.
+     * @param fields The fields of the event.
+     */
+    void report(std::string_view event, std::string_view format, std::initializer_list<ReportField> fields) override;
+
+    /**
+     * @brief Do nothing, as nothing is buffered.
+     */
+    void flush() override;
+};
+
+#endif // REPORT_SINK_NULL_HPP
@@ -0,0 +1,61 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REPORT_SINK_TEXT_HPP
+#define REPORT_SINK_TEXT_HPP
+
+#include "reportSink.hpp"
+#include <mutex>
+#include <ostream>
+#include <string>
+
+/**
+ * @class ReportSinkText
+ * @brief Report sink writing human-readable lines to a stream.
+ *
+ * The ReportSinkText class writes the format of each report with its fields in place
+ * of the placeholders, followed by a new line. Reports are gathered in a buffer written
+ * to the stream once it reaches the buffer size, without ever flushing the stream line
+ * by line. A buffer size of zero writes each report as soon as it is made.
+ */
+class ReportSinkText : public ReportSink
+{
+  public:
+    /**
+     * @brief Create a sink writing to a stream.
+     * @param output The stream, which must outlive the sink.
+     * @param bufferSize The number of bytes gathered before writing them to the stream.
+     */
+    explicit ReportSinkText(std::ostream& output, size_t bufferSize = 0);
+
+    /**
+     * @brief Destructor, writing out the buffered reports.
+     */
+    ~ReportSinkText() override;
+
+    /**
+     * @brief Write a report as a line of text.
+     * @param event The name of the event, not written.
+     * @param format The text of the event, with a "{}" placeholder for each field.
+     * @param fields The fields of the event, in the order of the placeholders.
+     */
+    void report(std::string_view event, std::string_view format, std::initializer_list<ReportField> fields) override;
+
+    /**
+     * @brief Write the buffered reports to the stream and flush it.
+     */
+    void flush() override;
+
+  private:
+    std::ostream& m_output; /**< The stream the reports are written to. */
+    size_t m_bufferSize;    /**< The number of bytes gathered before writing them. */
+    std::string m_buffer;   /**< The reports not yet written. */
+    std::mutex m_mutex;     /**< Serializes the reports of concurrent tracks. */
+};
+
+#endif // REPORT_SINK_TEXT_HPP
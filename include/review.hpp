@@ -9,6 +9,8 @@
 #ifndef REVIEW_HPP
 #define REVIEW_HPP
 
+#include "reportSink.hpp"
+#include <cstdint>
 #include <string>
 
 /**
@@ -18,7 +20,7 @@
  * This enumeration defines the possible ratings that can be assigned to a review,
  * ranging from "Excellent" to "Not Recommended".
  */
-enum class Rating
+enum class Rating : std::int8_t
 {
     Excellent = 3,
     VeryGood = 2,
@@ -29,6 +31,20 @@ enum class Rating
     NotRecommended = -3
 };
 
+/**
+ * @enum Confidence
+ * @brief Enum class representing how confident a reviewer is about a review.
+ *
+ * The value of each level is the weight of the review when the reviews of an
+ * article are aggregated into a score.
+ */
+enum class Confidence : std::uint8_t
+{
+    Low = 1,
+    Medium = 2,
+    High = 3
+};
+
 /**
  * @class Review
  * @brief Represents a review in the conference.
@@ -48,13 +64,14 @@ class Review
     Review() = default;
 
     /**
-     * @brief Parameterized constructor to initialize a review with text and rating.
+     * @brief Parameterized constructor to initialize a review with text, rating and confidence.
      * @param text The text of the review.
      * @param rating The rating assigned to the review.
+     * @param confidence The confidence of the reviewer on the rating.
      *
-     * Constructs a Review object with the specified review text and rating.
+     * Constructs a Review object with the specified review text, rating and confidence.
      */
-    Review(const std::string& text, Rating rating);
+    Review(const std::string& text, Rating rating, Confidence confidence = Confidence::Medium);
 
     /**
      * @brief Default destructor.
@@ -87,17 +104,35 @@ class Review
      */
     void rating(Rating rating);
 
+    /**
+     * @brief Getter for the confidence of the review.
+     * @return The confidence of the reviewer on the rating.
+     *
+     * Retrieves the confidence associated with the review.
+     */
+    Confidence confidence() const;
+
+    /**
+     * @brief Setter for the confidence of the review.
+     * @param confidence The new confidence of the reviewer on the rating.
+     *
+     * Updates the confidence associated with the review.
+     */
+    void confidence(Confidence confidence);
+
     /**
      * @brief Display the review.
+     * @param sink The sink receiving the review.
      *
-     * Outputs the review text and rating to the standard output, providing a
+     * Outputs the review text, rating and confidence to the sink, providing a
      * comprehensive overview of the review's content.
      */
-    void printReview() const;
+    void printReview(ReportSink& sink = *ReportSink::standard()) const;
 
   private:
-    std::string m_text; /**< The textual content of the review. */
-    Rating m_rating;    /**< The rating assigned to the review. */
+    std::string m_text;                          /**< The textual content of the review. */
+    Rating m_rating;                             /**< The rating assigned to the review. */
+    Confidence m_confidence{Confidence::Medium}; /**< The confidence of the reviewer on the rating. */
 };
 
 #endif // REVIEW_HPP
@@ -0,0 +1,126 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REVIEW_AGGREGATE_HPP
+#define REVIEW_AGGREGATE_HPP
+
+#include "review.hpp"
+#include <cstdint>
+
+/**
+ * @class ReviewAggregate
+ * @brief Running summary of the reviews of an article.
+ *
+ * The ReviewAggregate class folds the reviews of an article one at a time, weighting
+ * each rating by the confidence of its reviewer. It keeps the count, the total weight,
+ * the weighted sum, the minimum and maximum ratings and a weighted Welford mean and
+ * variance, so the whole summary is built in a single streaming pass without storing
+ * the reviews. The weighted sum is kept as an integer, so the rating and the score key
+ * derived from it are exact and reproducible.
+ */
+class ReviewAggregate
+{
+  public:
+    static constexpr std::int32_t SCORE_SCALE = 1000; /**< Fixed-point scale of the score key. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an aggregate with no reviews.
+     */
+    ReviewAggregate() = default;
+
+    /**
+     * @brief Fold a review into the aggregate.
+     * @param review The review to add.
+     */
+    void add(const Review& review);
+
+    /**
+     * @brief Fold a rating into the aggregate.
+     * @param rating The rating of the review.
+     * @param confidence The confidence of the reviewer on the rating.
+     */
+    void add(Rating rating, Confidence confidence);
+
+    /**
+     * @brief Check whether the aggregate holds any review.
+     * @return True if no review was added, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the number of reviews.
+     * @return The number of reviews added.
+     */
+    std::uint32_t count() const;
+
+    /**
+     * @brief Get the total weight of the reviews.
+     * @return The sum of the confidences of the reviews added.
+     */
+    std::uint32_t weight() const;
+
+    /**
+     * @brief Get the weighted sum of the ratings.
+     * @return The sum of each rating multiplied by its confidence.
+     */
+    std::int64_t weightedSum() const;
+
+    /**
+     * @brief Get the weighted mean of the ratings.
+     * @return The weighted mean, or 0 if there are no reviews.
+     */
+    double mean() const;
+
+    /**
+     * @brief Get the weighted variance of the ratings.
+     * @return The weighted population variance, or 0 if there are no reviews.
+     *
+     * A high variance flags an article on which the reviewers disagree.
+     */
+    double variance() const;
+
+    /**
+     * @brief Get the lowest rating.
+     * @return The lowest rating added, only meaningful if the aggregate is not empty.
+     */
+    Rating min() const;
+
+    /**
+     * @brief Get the highest rating.
+     * @return The highest rating added, only meaningful if the aggregate is not empty.
+     */
+    Rating max() const;
+
+    /**
+     * @brief Get the rating of the article.
+     * @return The weighted mean rounded up to a Rating.
+     */
+    Rating rating() const;
+
+    /**
+     * @brief Get the fixed-point score of the article.
+     * @return The weighted mean multiplied by SCORE_SCALE and rounded up.
+     *
+     * Ordering articles by this key orders them by rating first and by mean within a
+     * rating, since the rating is the score key divided by SCORE_SCALE and rounded up.
+     */
+    std::int32_t scoreKey() const;
+
+  private:
+    std::int64_t m_weightedSum{0};        /**< The sum of each rating multiplied by its confidence. */
+    std::uint32_t m_count{0};             /**< The number of reviews. */
+    std::uint32_t m_weight{0};            /**< The sum of the confidences. */
+    double m_mean{0.0};                   /**< The running weighted mean. */
+    double m_squaredDeviations{0.0};      /**< The running weighted sum of squared deviations from the mean. */
+    Rating m_min{Rating::Excellent};      /**< The lowest rating. */
+    Rating m_max{Rating::NotRecommended}; /**< The highest rating. */
+};
+
+#endif // REVIEW_AGGREGATE_HPP
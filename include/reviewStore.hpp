@@ -0,0 +1,177 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REVIEW_STORE_HPP
+#define REVIEW_STORE_HPP
+
+#include "identifiers.hpp"
+#include "review.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct StoredReview
+ * @brief Fixed-width record of a review held by a ReviewStore.
+ *
+ * The text of the review is the id of a text of its store, so a record keeps the same small
+ * size whatever the length of the text, and the reviews sharing a text share its bytes.
+ */
+struct StoredReview
+{
+    ReviewerId reviewer;   /**< The id of the reviewer in the track, or ReviewStore::NO_REVIEWER. */
+    ArticleId article;     /**< The id of the article in the track. */
+    std::uint32_t text;    /**< The id of the text in the store. */
+    Rating rating;         /**< The rating assigned to the article. */
+    Confidence confidence; /**< The confidence of the reviewer on the rating. */
+};
+
+/**
+ * @class ReviewStore
+ * @brief Compact storage of the reviews of a track.
+ *
+ * The ReviewStore class keeps every review of a track once, as a StoredReview appended to a
+ * single vector. The texts of the reviews are interned in an append-only arena, so a text
+ * written by many reviews, such as the one a reviewer signs each of its reviews with, is
+ * stored a single time. The reviews of an article and the reviews of a reviewer are lists
+ * of indexes into the records, in the order the reviews were added.
+ *
+ * Reviews submitted without a known reviewer are recorded with NO_REVIEWER and only appear
+ * in the list of their article.
+ */
+class ReviewStore
+{
+  public:
+    /** The reviewer of a review whose reviewer is unknown. */
+    static constexpr ReviewerId NO_REVIEWER = std::numeric_limits<ReviewerId>::max();
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty store, without any article.
+     */
+    ReviewStore() = default;
+
+    /**
+     * @brief Get the id of a text, adding it to the arena if it is not there yet.
+     * @param text The text.
+     * @return The id of the text, the same for every equal text.
+     */
+    std::uint32_t intern(std::string_view text);
+
+    /**
+     * @brief Add a review whose text is already interned.
+     * @param reviewer The id of the reviewer in the track, or NO_REVIEWER.
+     * @param article The id of the reviewed article in the track.
+     * @param text The id of the text of the review.
+     * @param rating The rating assigned to the article.
+     * @param confidence The confidence of the reviewer on the rating.
+     * @return The index of the review.
+     *
+     * The list of the article grows to include it if needed.
+     */
+    std::uint32_t add(ReviewerId reviewer, ArticleId article, std::uint32_t text, Rating rating,
+                      Confidence confidence);
+
+    /**
+     * @brief Add a review, interning its text.
+     * @param reviewer The id of the reviewer in the track, or NO_REVIEWER.
+     * @param article The id of the reviewed article in the track.
+     * @param review The review.
+     * @return The index of the review.
+     */
+    std::uint32_t add(ReviewerId reviewer, ArticleId article, const Review& review);
+
+    /**
+     * @brief Grow the lists of the articles.
+     * @param articles The number of articles of the track.
+     *
+     * Articles never lose their reviews, so the store is never shrunk.
+     */
+    void resize(size_t articles);
+
+    /**
+     * @brief Get the number of reviews.
+     * @return The number of reviews of every article.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check whether the store holds any review.
+     * @return True if no review was added, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the number of articles.
+     * @return The number of articles the store has a list for.
+     */
+    size_t articles() const;
+
+    /**
+     * @brief Get the number of distinct texts.
+     * @return The number of texts interned, text ids being lower.
+     */
+    size_t texts() const;
+
+    /**
+     * @brief Get the size of the text arena.
+     * @return The bytes of every distinct text.
+     */
+    size_t textBytes() const;
+
+    /**
+     * @brief Get a review.
+     * @param review The index of the review.
+     * @return The record of the review.
+     */
+    const StoredReview& operator[](std::uint32_t review) const;
+
+    /**
+     * @brief Get an interned text.
+     * @param text The id of the text.
+     * @return The text, valid until the next text is interned.
+     */
+    std::string_view text(std::uint32_t text) const;
+
+    /**
+     * @brief Build a standalone copy of a review.
+     * @param review The index of the review.
+     * @return The review, with its own copy of the text.
+     */
+    Review review(std::uint32_t review) const;
+
+    /**
+     * @brief Get the reviews of an article.
+     * @param article The id of the article.
+     * @return The indexes of the reviews of the article, empty if the article has none.
+     */
+    std::span<const std::uint32_t> articleReviews(ArticleId article) const;
+
+    /**
+     * @brief Get the reviews written by a reviewer.
+     * @param reviewer The id of the reviewer in the track.
+     * @return The indexes of the reviews of the reviewer, empty if the reviewer wrote none.
+     */
+    std::span<const std::uint32_t> reviewerReviews(ReviewerId reviewer) const;
+
+  private:
+    std::string m_arena;                                      /**< The bytes of every distinct text, back to back. */
+    std::vector<std::uint32_t> m_offsets{0};                  /**< The offset of each text, then the end offset. */
+    std::unordered_map<std::uint64_t, std::uint32_t> m_texts; /**< The id of each text, by the hash of the text. */
+    std::vector<StoredReview> m_records;                      /**< The reviews, in the order they were added. */
+    std::vector<std::vector<std::uint32_t>> m_byArticle;      /**< The indexes of the reviews of each article. */
+    std::vector<std::vector<std::uint32_t>> m_byReviewer;     /**< The indexes of the reviews of each reviewer. */
+};
+
+#endif // REVIEW_STORE_HPP
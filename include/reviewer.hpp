@@ -11,10 +11,13 @@
 
 #include "bid.hpp"
 #include "itrackState.hpp"
+#include "randomStream.hpp"
 #include "review.hpp"
 #include "user.hpp"
+#include <cstdint>
 #include <memory>
-#include <random>
+#include <optional>
+#include <utility>
 #include <vector>
 
 /**
@@ -24,6 +27,14 @@
  * The Reviewer class extends the User class to provide specific functionalities
  * related to reviewers, such as managing bids and reviews. It encapsulates the
  * details and behaviors associated with a reviewer in the conference system.
+ *
+ * The simulated bids and reviews are drawn from counter-based random streams keyed by
+ * the seed of the reviewer, the reviewer's full name and the article, so a simulation is
+ * reproducible from its seed and gives the same results whatever the number of threads.
+ *
+ * The reviews written by the review phase of a track are kept in the ReviewStore of the
+ * track, listed under the reviewer's id in the track; reviews() only holds the reviews
+ * submitted to the reviewer or written by the reviewArticle overloads returning a Review.
  */
 class Reviewer : public User
 {
@@ -41,11 +52,11 @@ class Reviewer : public User
      * @param userJson A JSON object containing the reviewer's information.
      *
      * Constructs a Reviewer object by parsing the provided JSON data, extracting
-     * relevant fields such as user details.
+     * relevant fields such as user details and the optional "bidRate", the share of
+     * the articles the reviewer bids on. Throws an invalid_argument exception if the
+     * bid rate is outside [0, 1].
      */
-    explicit Reviewer(const nlohmann::json& userJson) : User(userJson)
-    {
-    }
+    explicit Reviewer(const nlohmann::json& userJson);
 
     /**
      * @brief Default destructor.
@@ -95,20 +106,197 @@ class Reviewer : public User
      * @return A Bid object representing the reviewer's interest in an article.
      *
      * This method determines the reviewer's interest in an article and places a bid accordingly.
+     * Each call draws from the next event of the reviewer's own sequence.
      */
     Bid determineInterest() override;
 
+    /**
+     * @brief Determines and places a bid on a given article.
+     * @param event A stable key of the article, such as the hash of its name.
+     * @return A Bid object representing the reviewer's interest in the article.
+     *
+     * The interest depends only on the seed, the reviewer and the event, so calls for
+     * different articles may run on any thread in any order.
+     */
+    Bid determineInterest(std::uint64_t event) override;
+
+    /**
+     * @brief Determines the interest in a given article into the bids of a track.
+     * @param event A stable key of the article, such as the hash of its name.
+     * @param bids The bids of the track, receiving the interest.
+     * @param reviewer The id of the reviewer among the reviewers of the track.
+     * @param article The id of the article in the track.
+     *
+     * The interest is the one determineInterest(event) draws. It is only written in the cell
+     * of the matrix: the reviewer records no Bid, so its bids in a track are the matrix row.
+     */
+    void determineInterest(std::uint64_t event, BidMatrix& bids, ReviewerId reviewer, ArticleId article) override;
+
     /**
      * @brief Reviews an article.
      * @return A Review object containing the reviewer's evaluation of an article.
      *
      * This method allows the reviewer to evaluate and review an article.
+     * Each call draws from the next event of the reviewer's own sequence.
      */
     Review reviewArticle() override;
 
+    /**
+     * @brief Reviews a given article.
+     * @param event A stable key of the article, such as the hash of its name.
+     * @return A Review object containing the reviewer's evaluation of the article.
+     *
+     * The evaluation depends only on the seed, the reviewer and the event, so calls for
+     * different articles may run on any thread in any order.
+     */
+    Review reviewArticle(std::uint64_t event) override;
+
+    /**
+     * @brief Reviews a given article into the reviews of a track.
+     * @param event A stable key of the article, such as the hash of its name.
+     * @param reviews The reviews of the track, receiving the review.
+     * @param reviewer The id of the reviewer among the reviewers of the track.
+     * @param article The id of the article in the track.
+     * @return The index of the review in the store.
+     *
+     * The rating and confidence are the ones reviewArticle(event) draws. The review is only
+     * recorded in the store, where it is listed under both the article and the reviewer, and
+     * its text, the same for every review of the reviewer, is interned once per store.
+     */
+    std::uint32_t reviewArticle(std::uint64_t event, ReviewStore& reviews, ReviewerId reviewer,
+                                ArticleId article) override;
+
+    /**
+     * @brief Getter for the bid rate.
+     * @return The share of the articles the reviewer bids on, if it was given.
+     *
+     * Without a bid rate, the reviewer bids on three articles out of four, each
+     * interest being equally likely.
+     */
+    std::optional<double> bidRate() const;
+
+    /**
+     * @brief Getter for the simulation seed.
+     * @return The seed the random decisions of the reviewer are derived from.
+     */
+    std::uint64_t seed() const;
+
+    /**
+     * @brief Setter for the simulation seed.
+     * @param seed The seed the random decisions of the reviewer are derived from.
+     */
+    void seed(std::uint64_t seed);
+
   private:
+    friend class ReviewerBuffer;
+
+    /**
+     * @brief Place a bid drawn from a stream.
+     * @param stream The random stream of the bid.
+     * @return The bid, also recorded in the bids of the reviewer.
+     */
+    Bid placeBid(RandomStream& stream);
+
+    /**
+     * @brief Draw the interest of a bid.
+     * @param stream The random stream of the bid.
+     * @return The interest, None when the reviewer does not bid.
+     */
+    BiddingInterest drawInterest(RandomStream& stream) const;
+
+    /**
+     * @brief Write a review drawn from a stream.
+     * @param stream The random stream of the review.
+     * @return The review, also recorded in the reviews of the reviewer.
+     */
+    Review writeReview(RandomStream& stream);
+
+    /**
+     * @brief Draw the rating and confidence of a review.
+     * @param stream The random stream of the review.
+     * @return The rating and the confidence.
+     */
+    static std::pair<Rating, Confidence> drawReview(RandomStream& stream);
+
+    /**
+     * @brief Compose the text the reviewer signs its reviews with.
+     * @param text The string receiving the text, replacing its content.
+     */
+    void composeReviewText(std::string& text) const;
+
+    /**
+     * @brief Get the key of the random streams of the reviewer.
+     * @return The seed mixed with the hash of the full name.
+     */
+    std::uint64_t streamKey() const;
+
     std::vector<Bid> m_bids;                        /**< Vector of bids placed by the reviewer. */
     std::vector<std::shared_ptr<Review>> m_reviews; /**< Vector of reviews submitted by the reviewer. */
+    std::uint64_t m_seed{0};                        /**< The seed of the simulated decisions. */
+    std::uint64_t m_events{0};                      /**< The events drawn by the calls without an article. */
+    std::optional<double> m_bidRate;                /**< The share of the articles the reviewer bids on. */
+};
+
+/**
+ * @class ReviewerBuffer
+ * @brief Holds the bids and reviews placed by reviewers while a phase runs in parallel.
+ *
+ * Reviewers are shared between the tracks of a conference, so tracks running their
+ * bidding or review concurrently would append to the same vectors of a reviewer. While
+ * a buffer is bound to a thread through a Scope, the bids and reviews placed on that
+ * thread are recorded in the buffer instead, and merge appends them to their reviewers
+ * once the parallel work is over. Merging the buffers of the tracks in track order leaves
+ * every reviewer with the same history as running the tracks one after the other.
+ */
+class ReviewerBuffer
+{
+  public:
+    /**
+     * @class Scope
+     * @brief Binds a buffer to the current thread for its lifetime.
+     *
+     * Scopes nest: the buffer bound before the scope, if any, is bound again when it ends.
+     */
+    class Scope
+    {
+      public:
+        /**
+         * @brief Bind a buffer to the current thread.
+         * @param buffer The buffer recording the bids and reviews placed on this thread.
+         */
+        explicit Scope(ReviewerBuffer& buffer);
+
+        /**
+         * @brief Restore the buffer bound before this scope.
+         */
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        ReviewerBuffer* m_previous; /**< The buffer bound to the thread before this scope. */
+    };
+
+    /**
+     * @brief Append the recorded bids and reviews to their reviewers.
+     *
+     * The entries are appended in the order they were recorded and the buffer is left
+     * empty. Must not run concurrently with any other access to the same reviewers.
+     */
+    void merge();
+
+    /**
+     * @brief Check whether the buffer holds any entry.
+     * @return True if no bid or review is waiting to be merged, false otherwise.
+     */
+    bool empty() const;
+
+  private:
+    friend class Reviewer;
+
+    std::vector<std::pair<Reviewer*, Bid>> m_bids;                        /**< Bids recorded with their reviewer. */
+    std::vector<std::pair<Reviewer*, std::shared_ptr<Review>>> m_reviews; /**< Reviews recorded with their reviewer. */
 };
 
 #endif // USER_REVIEWER_HPP
@@ -9,9 +9,11 @@
 #ifndef SELECTION_STRATEGY_HPP
 #define SELECTION_STRATEGY_HPP
 
-#include "articleInterface.hpp"
+#include "identifiers.hpp"
+#include "leaderboard.hpp"
 #include "review.hpp"
-#include <unordered_map>
+#include "reviewAggregate.hpp"
+#include <span>
 #include <vector>
 
 /**
@@ -34,16 +36,27 @@ class SelectionStrategy
 
     /**
      * @brief Select articles based on their ratings.
-     * @param selectedArticles The vector to store the selected articles.
-     * @param ratingMap A map containing articles and their corresponding ratings.
+     * @param selectedArticles The vector to store the ids of the selected articles.
+     * @param scores The aggregated reviews of each article, indexed by article id. Unreviewed articles are empty.
      * @param selectionThreshold The number of articles to select.
      *
      * This pure virtual method must be implemented by derived classes to define
      * the selection algorithm. The method populates the selectedArticles vector
-     * with articles chosen based on their ratings.
+     * with the ids of the articles chosen based on their ratings.
      */
-    virtual void select(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                        const std::unordered_map<std::shared_ptr<Article>, Rating>& ratingMap,
+    virtual void select(std::vector<ArticleId>& selectedArticles, std::span<const ReviewAggregate> scores,
+                        int selectionThreshold) = 0;
+
+    /**
+     * @brief Select articles from the live ranking of a track.
+     * @param selectedArticles The vector to store the ids of the selected articles.
+     * @param leaderboard The ranking of the articles, kept up to date during the review phase.
+     * @param selectionThreshold The number of articles to select.
+     *
+     * This pure virtual method must be implemented by derived classes to select the same articles as
+     * from the scores, by reading the already ordered ranking instead of ranking the articles again.
+     */
+    virtual void select(std::vector<ArticleId>& selectedArticles, const Leaderboard& leaderboard,
                         int selectionThreshold) = 0;
 };
 
@@ -9,10 +9,11 @@
 #ifndef SELECTION_STRATEGY_BEST_HPP
 #define SELECTION_STRATEGY_BEST_HPP
 
-#include "articleInterface.hpp"
+#include "identifiers.hpp"
 #include "review.hpp"
+#include "reviewAggregate.hpp"
 #include "selectionStrategy.hpp"
-#include <unordered_map>
+#include <span>
 #include <vector>
 
 /**
@@ -28,16 +29,29 @@ class SelectionStrategyBest : public SelectionStrategy
   public:
     /**
      * @brief Select the top-rated articles based on their ratings.
-     * @param selectedArticles The vector to store the selected articles.
-     * @param ratingMap A map containing articles and their corresponding ratings.
+     * @param selectedArticles The vector to store the ids of the selected articles.
+     * @param scores The aggregated reviews of each article, indexed by article id.
      * @param selectionThreshold The number of articles to select.
      *
      * This method populates the selectedArticles vector with the top-rated articles
-     * from the ratingMap, up to the number specified by selectionThreshold. It overrides
+     * from the scores, up to the number specified by selectionThreshold. It overrides
      * the pure virtual method defined in the SelectionStrategy base class.
      */
-    void select(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                const std::unordered_map<std::shared_ptr<Article>, Rating>& ratingMap, int selectionThreshold) override;
+    void select(std::vector<ArticleId>& selectedArticles, std::span<const ReviewAggregate> scores,
+                int selectionThreshold) override;
+
+    /**
+     * @brief Select the articles rated at least a threshold from the live ranking of a track.
+     * @param selectedArticles The vector to store the ids of the selected articles.
+     * @param leaderboard The ranking of the articles.
+     * @param selectionThreshold The lowest rating selected, from -3 to +3.
+     *
+     * Counts the articles at or above the threshold in O(log L), reads them from the top of the
+     * ranking and sorts their ids, so the selection matches the one made from the scores. When
+     * most articles reach the threshold, scanning the scores is cheaper than sorting, and is used.
+     */
+    void select(std::vector<ArticleId>& selectedArticles, const Leaderboard& leaderboard,
+                int selectionThreshold) override;
 };
 
 #endif // SELECTION_STRATEGY_BEST_HPP
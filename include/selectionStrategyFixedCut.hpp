@@ -9,10 +9,11 @@
 #ifndef SELECTION_STRATEGY_FIXED_CUT_HPP
 #define SELECTION_STRATEGY_FIXED_CUT_HPP
 
-#include "articleInterface.hpp"
+#include "identifiers.hpp"
 #include "review.hpp"
+#include "reviewAggregate.hpp"
 #include "selectionStrategy.hpp"
-#include <unordered_map>
+#include <span>
 #include <vector>
 
 /**
@@ -21,23 +22,46 @@
  *
  * The SelectionStrategyFixedCut class extends the SelectionStrategy class to provide an implementation
  * that selects a fixed number of top-rated articles based on their ratings. It uses the ratings to determine
- * which articles to select, up to a specified threshold.
+ * which articles to select, up to a specified threshold. Articles are ranked on the fixed-point score of their
+ * aggregated reviews, which has a few thousand possible values, so the cut is computed with a counting pass
+ * instead of a sort, in linear time.
  */
 class SelectionStrategyFixedCut : public SelectionStrategy
 {
   public:
     /**
      * @brief Select the top-rated articles based on their ratings.
-     * @param selectedArticles The vector to store the selected articles.
-     * @param ratingMap A map containing articles and their corresponding ratings.
+     * @param selectedArticles The vector to store the ids of the selected articles.
+     * @param scores The aggregated reviews of each article, indexed by article id.
      * @param selectionThreshold The number of articles to select.
      *
      * This method populates the selectedArticles vector with the top-rated articles
-     * from the ratingMap, up to the number specified by selectionThreshold. It overrides
-     * the pure virtual method defined in the SelectionStrategy base class.
+     * from the scores, up to the number specified by selectionThreshold. The selected ids are
+     * ordered by rating, then by weighted mean, and articles with the same score by ascending
+     * id, so the cut is reproducible between runs. It overrides the pure virtual method defined
+     * in the SelectionStrategy base class.
      */
-    void select(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                const std::unordered_map<std::shared_ptr<Article>, Rating>& ratingMap, int selectionThreshold) override;
+    void select(std::vector<ArticleId>& selectedArticles, std::span<const ReviewAggregate> scores,
+                int selectionThreshold) override;
+
+    /**
+     * @brief Select the top-rated articles from the live ranking of a track.
+     * @param selectedArticles The vector to store the ids of the selected articles.
+     * @param leaderboard The ranking of the articles.
+     * @param selectionThreshold The percentage of the reviewed articles to select.
+     *
+     * Selects the same articles, in the same order, as from the scores, by reading the best
+     * articles of the ranking in O(k) for k selected articles. A cut taking a large share of the
+     * articles falls back to the counting pass, which is cheaper per article.
+     */
+    void select(std::vector<ArticleId>& selectedArticles, const Leaderboard& leaderboard,
+                int selectionThreshold) override;
+
+  private:
+    static constexpr int RATING_RANGE =
+        static_cast<int>(Rating::Excellent) - static_cast<int>(Rating::NotRecommended); /**< Span of the ratings. */
+    static constexpr size_t SCORE_LEVELS =
+        RATING_RANGE * ReviewAggregate::SCORE_SCALE + 1; /**< The number of distinct score keys. */
 };
 
 #endif // SELECTION_STRATEGY_FIXED_CUT_HPP
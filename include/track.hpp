@@ -10,12 +10,17 @@
 #define TRACK_HPP
 
 #include "articleInterface.hpp"
+#include "assignmentStrategy.hpp"
 #include "itrackState.hpp"
+#include "mutationLog.hpp"
+#include "reportSink.hpp"
 #include "selectionStrategy.hpp"
+#include "trackPhase.hpp"
+#include "trackResult.hpp"
 #include "user.hpp"
 #include <memory>
+#include <span>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 /**
@@ -46,33 +51,60 @@ class Track
      * @brief Handle an article within the track.
      * @param article The article to handle.
      * @param operation The operation to perform (Create, Update, Delete).
+     * @return The outcome of the operation, with the reason code of a rejection.
      *
      * This pure virtual method must be implemented by derived classes to manage articles within the track.
      */
-    virtual void handleTrackArticle(const std::shared_ptr<Article>& article, OperationType operation) = 0;
+    virtual TrackResult handleTrackArticle(const std::shared_ptr<Article>& article, OperationType operation) = 0;
+
+    /**
+     * @brief Handle a batch of articles within the track.
+     * @param articles The articles to handle.
+     * @param operation The operation to perform on every article (Create, Update, Delete).
+     * @return The outcome of each article, by position in the batch.
+     *
+     * This pure virtual method must be implemented by derived classes to handle many articles at once, with the
+     * same outcome as handling them one after the other.
+     */
+    virtual std::vector<TrackResult> handleTrackArticles(std::span<const std::shared_ptr<Article>> articles,
+                                                         OperationType operation) = 0;
 
     /**
      * @brief Handle the bidding process for articles within the track.
+     * @return The outcome of the bidding, rejected outside the bidding phase.
      *
      * This pure virtual method must be implemented by derived classes to manage the bidding process for articles.
      */
-    virtual void handleTrackBidding() = 0;
+    virtual TrackResult handleTrackBidding() = 0;
 
     /**
      * @brief Handle the review process for articles within the track.
+     * @return The outcome of the review, rejected outside the review phase.
      *
      * This pure virtual method must be implemented by derived classes to manage the review process for articles.
      */
-    virtual void handleTrackReview() = 0;
+    virtual TrackResult handleTrackReview() = 0;
+
+    /**
+     * @brief Submit one review of an article of the track.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     * @return The outcome of the submission, rejected outside the review phase or for an unknown article.
+     *
+     * This pure virtual method must be implemented by derived classes to fold a review into the score of its
+     * article as soon as it arrives, without recomputing the scores of the other articles.
+     */
+    virtual TrackResult submitReview(ArticleId article, const Review& review) = 0;
 
     /**
      * @brief Handle the selection of articles within the track.
      * @param threshold The number of articles to select.
+     * @return The outcome of the selection, rejected outside the selection phase.
      *
      * This pure virtual method must be implemented by derived classes to manage the selection of articles based on a
      * threshold.
      */
-    virtual void handleTrackSelection(int threshold) = 0;
+    virtual TrackResult handleTrackSelection(int threshold) = 0;
 
     /**
      * @brief Get the name of the track.
@@ -84,11 +116,11 @@ class Track
 
     /**
      * @brief Set the state of the track.
-     * @param state A shared pointer to the new state of the track.
+     * @param state The new phase of the track.
      *
      * This pure virtual method must be implemented by derived classes to establish the track's current state.
      */
-    virtual void establishState(const std::shared_ptr<ITrackState>& state) = 0;
+    virtual void establishState(const TrackPhase& state) = 0;
 
     /**
      * @brief Print the current state of the track.
@@ -113,19 +145,30 @@ class Track
      */
     virtual void selectionStrategy(const std::shared_ptr<SelectionStrategy>& strategy) = 0;
 
+    /**
+     * @brief Set the assignment strategy for the track.
+     * @param strategy A shared pointer to the assignment strategy to be set.
+     *
+     * This pure virtual method must be implemented by derived classes to set the strategy that assigns articles to
+     * reviewers during the review phase.
+     */
+    virtual void assignmentStrategy(const std::shared_ptr<AssignmentStrategy>& strategy) = 0;
+
     /**
      * @brief Get the selected articles in the track.
-     * @return A vector of shared pointers to the selected articles.
+     * @return A constant reference to the vector of selected articles.
      *
      * This pure virtual method must be implemented by derived classes to return the selected articles in the track.
      */
-    virtual std::vector<std::shared_ptr<Article>> selectedArticles() = 0;
+    virtual const std::vector<std::shared_ptr<Article>>& selectedArticles() const = 0;
 
     /**
-     * @brief Get the number of bids in the track.
-     * @return The number of bids in the track.
+     * @brief Get the number of articles bid on in the track.
+     * @return The number of articles holding the bids of the reviewers, which is not the number of cells of the
+     * bid matrix.
      *
-     * This pure virtual method must be implemented by derived classes to return the number of bids in the track.
+     * This pure virtual method must be implemented by derived classes to return the number of articles bid on in
+     * the track.
      */
     virtual size_t amountBids() const = 0;
 
@@ -137,10 +180,11 @@ class Track
     virtual void currentBids() const = 0;
 
     /**
-     * @brief Get the number of reviews in the track.
-     * @return The number of reviews in the track.
+     * @brief Get the number of reviewed articles in the track.
+     * @return The number of articles holding at least one review, which is not the number of reviews.
      *
-     * This pure virtual method must be implemented by derived classes to return the number of reviews in the track.
+     * This pure virtual method must be implemented by derived classes to return the number of reviewed articles in
+     * the track.
      */
     virtual size_t amountReviews() const = 0;
 
@@ -158,6 +202,124 @@ class Track
      * This pure virtual method must be implemented by derived classes to add a reviewer to the track.
      */
     virtual void addReviewer(const std::shared_ptr<User>& reviewer) = 0;
+
+    /**
+     * @brief Get the articles in the track.
+     * @return The articles, the position of each one being its ArticleId.
+     *
+     * This pure virtual method must be implemented by derived classes to expose the articles of the track.
+     */
+    virtual const std::vector<std::shared_ptr<Article>>& articles() const = 0;
+
+    /**
+     * @brief Get the reviewers in the track.
+     * @return The reviewers, the position of each one being its ReviewerId.
+     *
+     * This pure virtual method must be implemented by derived classes to expose the reviewers of the track.
+     */
+    virtual const std::vector<std::shared_ptr<User>>& reviewers() const = 0;
+
+    /**
+     * @brief Get the bids placed in the track.
+     * @return The bids of every reviewer on every article.
+     *
+     * This pure virtual method must be implemented by derived classes to expose the bids of the track.
+     */
+    virtual const BidMatrix& bidMatrix() const = 0;
+
+    /**
+     * @brief Get the reviews written in the track.
+     * @return The reviews of the track, listed by article id and by reviewer id.
+     *
+     * This pure virtual method must be implemented by derived classes to expose the reviews of the track.
+     */
+    virtual const ReviewStore& reviewStore() const = 0;
+
+    /**
+     * @brief Get the live scores of the articles of the track.
+     * @return The aggregated reviews of each article, by article id, along with their ranking.
+     *
+     * This pure virtual method must be implemented by derived classes to expose the scores of the track, which
+     * are kept up to date as reviews are submitted, so the ranking can be queried during the review phase.
+     */
+    virtual const Leaderboard& articleScores() const = 0;
+
+    /**
+     * @brief Get the current state of the track.
+     * @return The current phase of the track.
+     *
+     * This pure virtual method must be implemented by derived classes to expose the state of the track.
+     */
+    virtual const TrackPhase& state() const = 0;
+
+    /**
+     * @brief Restore the articles of the track.
+     * @param articles The articles, in the order of their ArticleId.
+     * @return WrongArticleType or DuplicateArticle for the first article that cannot be restored.
+     *
+     * This pure virtual method must be implemented by derived classes to reload the articles of the track,
+     * for instance from a snapshot, adding them to the track whatever its state without replaying their
+     * submission, reporting them or recording them in the journal.
+     */
+    virtual TrackResult restoreArticles(std::span<const std::shared_ptr<Article>> articles) = 0;
+
+    /**
+     * @brief Restore the bids and reviews of the track.
+     * @param bids The bids of every reviewer on every article.
+     * @param reviews The reviews of the track.
+     *
+     * This pure virtual method must be implemented by derived classes to reload the results of the bidding
+     * and review phases, for instance from a snapshot, rebuilding the aggregated scores of the articles.
+     */
+    virtual void restoreResults(BidMatrix bids, ReviewStore reviews) = 0;
+
+    /**
+     * @brief Restore the bids of the track.
+     * @param bids The bids of every reviewer on every article.
+     *
+     * This pure virtual method must be implemented by derived classes to reload the bids of the bidding phase,
+     * for instance while replaying a log, keeping the reviews of the track.
+     */
+    virtual void restoreBids(BidMatrix bids) = 0;
+
+    /**
+     * @brief Restore one review of the track.
+     * @param reviewer The id of the reviewer who wrote it, or ReviewStore::NO_REVIEWER for a submitted review.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     * @return ArticleNotFound if the track holds no such article, in which case nothing is restored.
+     *
+     * This pure virtual method must be implemented by derived classes to add a review to the track whatever its
+     * state, for instance while replaying a log, keeping its reviewer and updating the score of its article.
+     */
+    virtual TrackResult restoreReview(ReviewerId reviewer, ArticleId article, const Review& review) = 0;
+
+    /**
+     * @brief Record the mutations of the track in a write-ahead log.
+     * @param journal The journal of the track, or a detached journal to stop recording.
+     *
+     * This pure virtual method must be implemented by derived classes to record article operations once they
+     * are applied, and the bids, reviews and state transitions of the track as they happen.
+     */
+    virtual void journal(const TrackJournal& journal) = 0;
+
+    /**
+     * @brief Set the sink receiving the messages of the track.
+     * @param sink The sink, shared with the states of the track while they run.
+     *
+     * This pure virtual method must be implemented by derived classes to send every message of the track, of
+     * its states and of the bids, reviews and articles it displays to the sink instead of the standard output.
+     */
+    virtual void reportSink(const std::shared_ptr<ReportSink>& sink) = 0;
+
+    /**
+     * @brief Set the index detecting the conflicts of interest of the track.
+     * @param index The affiliations of the people of the conference, shared with it.
+     *
+     * This pure virtual method must be implemented by derived classes to keep reviewers from being assigned the
+     * articles of their colleagues during the review phase.
+     */
+    virtual void conflictIndex(const std::shared_ptr<const ConflictIndex>& index) = 0;
 };
 
 #endif // TRACK_HPP
@@ -0,0 +1,367 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef TRACK_CORE_HPP
+#define TRACK_CORE_HPP
+
+#include "metrics.hpp"
+#include "reviewAggregate.hpp"
+#include "track.hpp"
+#include "user.hpp"
+#include <array>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class TrackCore
+ * @brief Containers and phase logic shared by every kind of track.
+ * @tparam Policy The policy describing the kind of track.
+ *
+ * The TrackCore class implements the Track interface once for all the kinds of tracks of
+ * the conference. It handles operations such as adding articles, managing bids and reviews,
+ * and selecting articles based on a strategy. What sets the kinds of tracks apart is
+ * given by the policy at compile time:
+ *
+ * - `Policy::ArticleType`, the only type of article the track accepts, or Article to accept
+ *   articles of every type;
+ * - `Policy::STATE_FORMAT`, the message reporting the state of the track.
+ *
+ * The regular, workshop and poster tracks are instantiations of this template, compiled once
+ * in trackCore.cpp. The class is final, so calls made on a known kind of track are not
+ * dispatched through the Track interface.
+ */
+template <typename Policy>
+class TrackCore final : public Track
+{
+  public:
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes a track with default values.
+     */
+    TrackCore() = default;
+
+    /**
+     * @brief Parameterized constructor to initialize a track with JSON data.
+     * @param trackData A JSON object containing the track data.
+     *
+     * Constructs a track by parsing the provided JSON data, extracting
+     * relevant fields such as track name and articles.
+     */
+    explicit TrackCore(const nlohmann::json& trackData);
+
+    /**
+     * @brief Parameterized constructor to initialize a track with specific values.
+     * @param trackName The name of the track.
+     * @param state The initial state of the track.
+     * @param users A vector of shared pointers to users involved in the track.
+     *
+     * Constructs a track with the specified track name, state, and users.
+     */
+    explicit TrackCore(const std::string& trackName, const TrackPhase& state,
+                       const std::vector<std::shared_ptr<User>>& users);
+
+    /**
+     * @brief Default destructor.
+     *
+     * Cleans up any resources used by the track.
+     */
+    ~TrackCore() = default;
+
+    /**
+     * @brief Handle an article within the track.
+     * @param article The article to handle.
+     * @param operation The operation to perform (Create, Update, Delete).
+     * @return The outcome of the operation, with the reason code of a rejection.
+     *
+     * Manages the specified article within the track based on the operation type. Articles of a type
+     * the policy does not accept are rejected without reaching the state.
+     */
+    TrackResult handleTrackArticle(const std::shared_ptr<Article>& article, OperationType operation) final;
+
+    /**
+     * @brief Handle a batch of articles within the track.
+     * @param articles The articles to handle.
+     * @param operation The operation to perform on every article (Create, Update, Delete).
+     * @return The outcome of each article, by position in the batch.
+     *
+     * Checks every article first, records the accepted ones in the journal with a single commit,
+     * and hands them to the state in one call, which grows the title index at most once.
+     */
+    std::vector<TrackResult> handleTrackArticles(std::span<const std::shared_ptr<Article>> articles,
+                                                 OperationType operation) final;
+
+    /**
+     * @brief Handle the bidding process for articles within the track.
+     * @return The outcome of the bidding, rejected outside the bidding phase.
+     *
+     * Manages the bidding process for articles in the track, associating articles with bids made by reviewers.
+     */
+    TrackResult handleTrackBidding() final;
+
+    /**
+     * @brief Handle the review process for articles within the track.
+     * @return The outcome of the review, rejected outside the review phase.
+     *
+     * Manages the review process for articles in the track, ensuring that articles are reviewed and rated by reviewers.
+     * The conflict mask, the assignments and the scratch of the assignment strategy live in a monotonic arena, freed
+     * in one go when the review returns instead of one container at a time.
+     */
+    TrackResult handleTrackReview() final;
+
+    /**
+     * @brief Submit one review of an article of the track.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     * @return The outcome of the submission, rejected outside the review phase or for an unknown article.
+     *
+     * Folds the review into the score of the article and records it in the journal once accepted.
+     */
+    TrackResult submitReview(ArticleId article, const Review& review) final;
+
+    /**
+     * @brief Handle the selection of articles within the track.
+     * @param threshold The number of articles to select.
+     * @return The outcome of the selection, rejected outside the selection phase.
+     *
+     * Manages the selection of articles based on the provided threshold and selection strategy.
+     */
+    TrackResult handleTrackSelection(int threshold) final;
+
+    /**
+     * @brief Get the name of the track.
+     * @return A constant reference to a string representing the track's name.
+     *
+     * Returns the name of the track.
+     */
+    const std::string& trackName() const final;
+
+    /**
+     * @brief Set the state of the track.
+     * @param state The new phase of the track.
+     *
+     * Establishes the current state of the track.
+     */
+    void establishState(const TrackPhase& state) final;
+
+    /**
+     * @brief Print the current state of the track.
+     *
+     * Outputs the current state of the track to the standard output.
+     */
+    void currentState() const final;
+
+    /**
+     * @brief Get the number of articles in the track.
+     * @return The number of articles in the track.
+     *
+     * Returns the number of articles in the track.
+     */
+    int amountArticles() const final;
+
+    /**
+     * @brief Set the selection strategy for the track.
+     * @param strategy A shared pointer to the selection strategy to be set.
+     *
+     * Establishes the selection strategy to be used for selecting articles in the track.
+     */
+    void selectionStrategy(const std::shared_ptr<SelectionStrategy>& strategy) final;
+
+    /**
+     * @brief Set the assignment strategy for the track.
+     * @param strategy A shared pointer to the assignment strategy to be set.
+     *
+     * Establishes the strategy used to assign articles to reviewers in the track. Tracks start with a round-robin
+     * assignment.
+     */
+    void assignmentStrategy(const std::shared_ptr<AssignmentStrategy>& strategy) final;
+
+    /**
+     * @brief Get the selected articles in the track.
+     * @return A constant reference to the vector of selected articles.
+     *
+     * Returns the selected articles in the track.
+     */
+    const std::vector<std::shared_ptr<Article>>& selectedArticles() const final;
+
+    /**
+     * @brief Get the number of articles bid on in the track.
+     * @return The number of articles of the bid matrix, or zero while no reviewer has bid.
+     *
+     * Returns the number of articles bid on in the track, one per column of the bid matrix.
+     */
+    size_t amountBids() const final;
+
+    /**
+     * @brief Print the current bids in the track.
+     *
+     * Outputs the current bids in the track to the standard output.
+     */
+    void currentBids() const final;
+
+    /**
+     * @brief Get the number of reviewed articles in the track.
+     * @return The number of articles holding at least one review.
+     *
+     * Returns the number of reviewed articles in the track. The number of reviews is the size of the review store.
+     */
+    size_t amountReviews() const final;
+
+    /**
+     * @brief Print the current reviews in the track.
+     *
+     * Outputs the current reviews in the track to the standard output.
+     */
+    void currentReviews() const final;
+
+    /**
+     * @brief Add a reviewer to the track.
+     * @param reviewer A shared pointer to the reviewer to be added.
+     *
+     * Adds the specified reviewer to the track.
+     */
+    void addReviewer(const std::shared_ptr<User>& reviewer) final;
+
+    /**
+     * @brief Get the articles in the track.
+     * @return The articles, the position of each one being its ArticleId.
+     */
+    const std::vector<std::shared_ptr<Article>>& articles() const final;
+
+    /**
+     * @brief Get the reviewers in the track.
+     * @return The reviewers, the position of each one being its ReviewerId.
+     */
+    const std::vector<std::shared_ptr<User>>& reviewers() const final;
+
+    /**
+     * @brief Get the bids placed in the track.
+     * @return The bids of every reviewer on every article.
+     */
+    const BidMatrix& bidMatrix() const final;
+
+    /**
+     * @brief Get the reviews written in the track.
+     * @return The reviews of the track, listed by article id and by reviewer id.
+     */
+    const ReviewStore& reviewStore() const final;
+
+    /**
+     * @brief Get the live scores of the articles of the track.
+     * @return The aggregated reviews of each article, by article id.
+     */
+    const Leaderboard& articleScores() const final;
+
+    /**
+     * @brief Get the current state of the track.
+     * @return The current phase of the track.
+     */
+    const TrackPhase& state() const final;
+
+    /**
+     * @brief Restore the articles of the track.
+     * @param articles The articles, in the order of their ArticleId.
+     * @return WrongArticleType or DuplicateArticle for the first article that cannot be restored.
+     *
+     * Appends the articles to the title index, only checking their type and the uniqueness of their titles.
+     * The articles before the first rejected one stay in the track.
+     */
+    TrackResult restoreArticles(std::span<const std::shared_ptr<Article>> articles) final;
+
+    /**
+     * @brief Restore the bids and reviews of the track.
+     * @param bids The bids of every reviewer on every article.
+     * @param reviews The reviews of the track.
+     *
+     * Replaces the bids and reviews of the track and rebuilds the aggregated scores.
+     */
+    void restoreResults(BidMatrix bids, ReviewStore reviews) final;
+
+    /**
+     * @brief Restore the bids of the track.
+     * @param bids The bids of every reviewer on every article.
+     *
+     * Replaces the bids of the track, leaving its reviews and scores alone.
+     */
+    void restoreBids(BidMatrix bids) final;
+
+    /**
+     * @brief Restore one review of the track.
+     * @param reviewer The id of the reviewer who wrote it, or ReviewStore::NO_REVIEWER for a submitted review.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     * @return ArticleNotFound if the track holds no such article.
+     *
+     * Adds the review to the store under its reviewer and folds it into the score of its article, without
+     * reporting it or recording it in the journal.
+     */
+    TrackResult restoreReview(ReviewerId reviewer, ArticleId article, const Review& review) final;
+
+    /**
+     * @brief Record the mutations of the track in a write-ahead log.
+     * @param journal The journal of the track, or a detached journal to stop recording.
+     */
+    void journal(const TrackJournal& journal) final;
+
+    /**
+     * @brief Set the sink receiving the messages of the track.
+     * @param sink The sink.
+     */
+    void reportSink(const std::shared_ptr<ReportSink>& sink) final;
+
+    /**
+     * @brief Set the index detecting the conflicts of interest of the track.
+     * @param index The affiliations of the people of the conference.
+     */
+    void conflictIndex(const std::shared_ptr<const ConflictIndex>& index) final;
+
+  private:
+    /**
+     * @brief Check whether an article is of the type accepted by the track.
+     * @param article The article.
+     * @return True if the policy accepts the article.
+     */
+    static bool accepts(const Article& article);
+
+    /** The number of reasons an operation may be rejected for, TrackError::None included. */
+    static constexpr size_t TRACK_ERRORS = static_cast<size_t>(TrackError::ArticleNotFound) + 1;
+
+    /**
+     * @brief Report the rejection of an operation to the sink of the track.
+     * @param result The outcome of the operation.
+     * @param article The article of the operation, if it was about one.
+     * @return The outcome of the operation, unchanged.
+     *
+     * Rejections are also counted in the Metrics of the process, by track and reason.
+     */
+    TrackResult report(TrackResult result, const Article* article = nullptr) const;
+
+    /**
+     * @brief Get the key of the track, which the simulated decisions on its articles depend on.
+     * @return The hash of the name of the track.
+     */
+    std::uint64_t trackKey() const;
+
+    std::string m_trackName;                                  /**< The name of the track. */
+    ArticleIndex m_articles;                                  /**< The title-indexed articles in the track. */
+    std::vector<std::shared_ptr<User>> m_reviewers;           /**< The reviewers in the track. */
+    std::vector<std::shared_ptr<Article>> m_selectedArticles; /**< The selected articles in the track. */
+    std::vector<ArticleId> m_selectedIds;                     /**< The ids of the last selection. */
+    TrackPhase m_currentState;                                /**< The current state of the track. */
+    std::shared_ptr<SelectionStrategy> m_selectionStrategy;   /**< The selection strategy used in the track. */
+    std::shared_ptr<AssignmentStrategy> m_assignmentStrategy; /**< The assignment strategy used in the track. */
+    BidMatrix m_bidMatrix;                                    /**< The bids of every reviewer on every article. */
+    ReviewStore m_reviews;                                    /**< The reviews, by article id and by reviewer id. */
+    Leaderboard m_articleScores;                              /**< The live ranking of the articles, by score. */
+    TrackJournal m_journal;                                   /**< The journal recording the mutations. */
+    std::shared_ptr<ReportSink> m_reportSink;                 /**< The sink receiving the messages. */
+    std::shared_ptr<const ConflictIndex> m_conflictIndex;     /**< The affiliations masking conflicts of interest. */
+    mutable std::array<Counter*, TRACK_ERRORS> m_rejected{};   /**< The rejection counters, looked up on first use. */
+};
+
+#endif // TRACK_CORE_HPP
@@ -0,0 +1,192 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef TRACK_PHASE_HPP
+#define TRACK_PHASE_HPP
+
+#include "itrackState.hpp"
+#include "trackStateBidding.hpp"
+#include "trackStateReception.hpp"
+#include "trackStateReview.hpp"
+#include "trackStateSelection.hpp"
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+/**
+ * @class TrackPhase
+ * @brief The phase a track is in, held by value.
+ *
+ * The TrackPhase class holds the state of a track as one alternative of a variant of the
+ * stateless state types, in the order a track goes through them: reception, bidding, review
+ * and selection. Changing phase overwrites the variant in place, without allocating.
+ *
+ * Operations are dispatched to the current state with std::visit. Whether a state allows an
+ * operation is decided at compile time by whether it implements it; an operation reaching a
+ * state that does not is not run, and its result is a PhaseClosed error carrying the reason
+ * given by the state.
+ */
+class TrackPhase
+{
+  public:
+    /**
+     * @brief The states of a track, in the order of the phases.
+     */
+    using State = std::variant<ReceptionStateTrack, BiddingStateTrack, ReviewStateTrack, SelectionStateTrack>;
+
+    /**
+     * @brief Default constructor, in the reception phase.
+     */
+    TrackPhase() = default;
+
+    /**
+     * @brief Create a phase from one of the states.
+     * @param state The state.
+     *
+     * Only the alternatives of State are accepted, so an invalid phase does not compile.
+     */
+    template <typename S>
+        requires std::is_constructible_v<State, S>
+    TrackPhase(S state) : m_state(state) // NOLINT(google-explicit-constructor)
+    {
+    }
+
+    /**
+     * @brief Get the name of the phase.
+     * @return The name of the current state.
+     */
+    std::string_view name() const;
+
+    /**
+     * @brief Get the position of the phase in the order of the phases.
+     * @return 0 for reception, 1 for bidding, 2 for review and 3 for selection.
+     */
+    std::size_t index() const;
+
+    /**
+     * @brief Check whether the track is in a given state.
+     * @tparam S The state.
+     * @return True if the current state is S.
+     */
+    template <typename S> bool is() const
+    {
+        return std::holds_alternative<S>(m_state);
+    }
+
+    /**
+     * @brief Find a phase by the name of its state.
+     * @param name The name of the state.
+     * @return The phase, or nothing if no state has that name.
+     */
+    static std::optional<TrackPhase> named(std::string_view name);
+
+    /**
+     * @brief Find a phase by its position.
+     * @param index The position of the phase, as returned by index.
+     * @return The phase, or nothing if the position is out of range.
+     */
+    static std::optional<TrackPhase> at(std::size_t index);
+
+    /**
+     * @brief Handle an article in a Create, Update, Delete (CUD) manner.
+     * @param articles The title-indexed articles of the track.
+     * @param article The article to handle.
+     * @param operation The type of operation to perform (Create, Update, Delete).
+     * @return The outcome of the operation.
+     */
+    TrackResult handleArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article,
+                              OperationType operation) const;
+
+    /**
+     * @brief Handle a batch of articles in a Create, Update, Delete (CUD) manner.
+     * @param articles The title-indexed articles of the track.
+     * @param submissions The articles to handle.
+     * @param operation The type of operation to perform on every article (Create, Update, Delete).
+     * @param results The outcome of each article, by position in the batch.
+     *
+     * Only the articles whose result holds no error yet are handled. When the phase does not allow
+     * handling articles, each of them is rejected with the same PhaseClosed error.
+     */
+    void handleArticles(ArticleIndex& articles, std::span<const std::shared_ptr<Article>> submissions,
+                        OperationType operation, std::span<TrackResult> results) const;
+
+    /**
+     * @brief Handle the bidding process for articles.
+     * @param articles The articles to bid on.
+     * @param trackKey The key of the track, mixed into the key of each article.
+     * @param biddingMatrix The bids of every reviewer on every article.
+     * @param reviewers The reviewers participating in the bidding process.
+     * @return The outcome of the operation.
+     */
+    TrackResult handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
+                              std::uint64_t trackKey,
+                              BidMatrix& biddingMatrix,
+                              const std::vector<std::shared_ptr<User>>& reviewers) const;
+
+    /**
+     * @brief Handle the review process for articles.
+     * @param articles The articles to review.
+     * @param trackKey The key of the track, mixed into the key of each article.
+     * @param biddingMatrix The bids of every reviewer on every article.
+     * @param assignmentStrategy The strategy deciding which reviewer reviews which article.
+     * @param conflicts The affiliations of the people of the conference, masking the conflicts of interest.
+     * @param reviews The reviews of the track, listed by article and by reviewer id.
+     * @param scores The live ranking of the articles, holding their aggregated reviews by article id.
+     * @param reviewers The reviewers conducting the reviews.
+     * @param sink The sink receiving the average rating of each reviewed article.
+     * @param arena The memory of the phase, released by the caller once the phase is over.
+     * @return The outcome of the operation.
+     */
+    TrackResult handleReview(const std::vector<std::shared_ptr<Article>>& articles,
+                             std::uint64_t trackKey,
+                             const BidMatrix& biddingMatrix,
+                             const std::shared_ptr<AssignmentStrategy>& assignmentStrategy,
+                             const ConflictIndex& conflicts,
+                             ReviewStore& reviews,
+                             Leaderboard& scores,
+                             const std::vector<std::shared_ptr<User>>& reviewers,
+                             ReportSink& sink,
+                             std::pmr::memory_resource& arena) const;
+
+    /**
+     * @brief Add one review to an article.
+     * @param articles The articles of the track.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     * @param reviews The reviews of the track, listed by article and by reviewer id.
+     * @param scores The live ranking of the articles, holding their aggregated reviews by article id.
+     * @param sink The sink receiving the new average rating of the article.
+     * @return The outcome of the operation.
+     */
+    TrackResult submitReview(const std::vector<std::shared_ptr<Article>>& articles,
+                             ArticleId article,
+                             const Review& review,
+                             ReviewStore& reviews,
+                             Leaderboard& scores,
+                             ReportSink& sink) const;
+
+    /**
+     * @brief Handle the selection of articles based on provided parameters.
+     * @param selectedArticles The ids of the selected articles.
+     * @param selectionStrategy A shared pointer to the selection strategy to be used.
+     * @param scores The live ranking of the articles, holding their aggregated reviews by article id.
+     * @param selectionThreshold The number of articles to be selected.
+     * @return The outcome of the operation.
+     */
+    TrackResult handleSelection(std::vector<ArticleId>& selectedArticles,
+                                const std::shared_ptr<SelectionStrategy>& selectionStrategy,
+                                const Leaderboard& scores,
+                                int selectionThreshold) const;
+
+  private:
+    State m_state; /**< The current state. */
+};
+
+#endif // TRACK_PHASE_HPP
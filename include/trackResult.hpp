@@ -0,0 +1,94 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef TRACK_RESULT_HPP
+#define TRACK_RESULT_HPP
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Why a track rejected an operation.
+ */
+enum class TrackError : std::uint8_t
+{
+    None,             /**< The operation was carried out. */
+    InvalidArticle,   /**< The article failed its own validity checks. */
+    WrongArticleType, /**< The track does not accept this type of article. */
+    PhaseClosed,      /**< The phase of the track does not allow the operation. */
+    DuplicateArticle, /**< The track already holds an article with the same title. */
+    ArticleNotFound   /**< The track holds no article with the title. */
+};
+
+/**
+ * @class TrackResult
+ * @brief Outcome of an operation on a track, in the manner of std::expected<void, TrackError>.
+ *
+ * A TrackResult either holds no error, when the operation was carried out, or the reason
+ * code of the rejection along with its message. Messages are static strings, so rejecting
+ * an operation allocates nothing, and callers branch on the code instead of catching.
+ */
+class TrackResult
+{
+  public:
+    /**
+     * @brief Default constructor, for an operation carried out.
+     */
+    constexpr TrackResult() = default;
+
+    /**
+     * @brief Create the result of a rejected operation.
+     * @param error The reason code of the rejection.
+     * @param message The description of the rejection, a static string.
+     */
+    constexpr TrackResult(TrackError error, std::string_view message) : m_error(error), m_message(message)
+    {
+    }
+
+    /**
+     * @brief Check whether the operation was carried out.
+     * @return True if there is no error.
+     */
+    constexpr bool hasValue() const
+    {
+        return m_error == TrackError::None;
+    }
+
+    /**
+     * @brief Check whether the operation was carried out.
+     * @return True if there is no error.
+     */
+    constexpr explicit operator bool() const
+    {
+        return hasValue();
+    }
+
+    /**
+     * @brief Get the reason code of the rejection.
+     * @return The error, or TrackError::None if the operation was carried out.
+     */
+    constexpr TrackError error() const
+    {
+        return m_error;
+    }
+
+    /**
+     * @brief Get the description of the rejection.
+     * @return The message, empty if the operation was carried out.
+     */
+    constexpr std::string_view message() const
+    {
+        return m_message;
+    }
+
+  private:
+    TrackError m_error{TrackError::None}; /**< The reason code of the rejection. */
+    std::string_view m_message;           /**< The description of the rejection. */
+};
+
+#endif // TRACK_RESULT_HPP
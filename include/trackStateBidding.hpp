@@ -10,106 +10,48 @@
 #define TRACK_STATE_BIDDING_HPP
 
 #include "itrackState.hpp"
-#include "track.hpp"
+#include <cstdint>
+#include <string_view>
 
 /**
  * @class BiddingStateTrack
  * @brief Represents the bidding state of a track in the conference.
  *
- * The BiddingStateTrack class implements the ITrackState interface to provide
- * functionalities specific to the bidding state of a track. It handles operations
- * such as adding articles, managing bids, and processing reviews and selections.
+ * The BiddingStateTrack class is the phase of a track in which reviewers bid on the articles
+ * of the track. It is one of the alternatives of TrackPhase and holds no data: it only
+ * implements the operation allowed in its phase, and names why each of the other operations
+ * is rejected.
  */
-class BiddingStateTrack : public ITrackState
+class BiddingStateTrack
 {
   public:
-    /**
-     * @brief Handle an article within the track in the bidding state.
-     * @param articles The list of articles to modify.
-     * @param article The article to handle.
-     * @param operation The operation to perform (Create, Update, Delete).
-     *
-     * Manages the specified article within the track based on the operation type during the bidding state.
-     */
-    void handleArticle(std::vector<std::shared_ptr<Article>>& articles, const std::shared_ptr<Article>& article,
-                       OperationType operation) override;
+    /** The name of the state. */
+    static constexpr std::string_view NAME = "Bidding";
+
+    /** Why articles are rejected. */
+    static constexpr std::string_view ARTICLE_REJECTION = "Cannot handle articles in Bidding state";
+
+    /** Why review is rejected. */
+    static constexpr std::string_view REVIEW_REJECTION = "Review is not allowed in bidding state";
+
+    /** Why selection is rejected. */
+    static constexpr std::string_view SELECTION_REJECTION = "Cannot handle selection in Bidding state";
 
     /**
      * @brief Handle the bidding process for articles within the track.
      * @param articles The articles to bid on.
-     * @param biddingMap A map of articles and their corresponding bids.
+     * @param trackKey The key of the track, mixed into the key of each article so the decisions on articles
+     * sharing a title in other tracks are drawn independently.
+     * @param biddingMatrix The bids of every reviewer on every article.
      * @param reviewers The reviewers participating in the bidding process.
      *
-     * Manages the bidding process for articles in the track, associating articles with bids made by reviewers.
+     * Asks every reviewer for their interest on every article. Each reviewer writes its interest straight into its
+     * own cell of the matrix, so bidding builds no Bid object per cell.
      */
     void handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                       std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                       const std::vector<std::shared_ptr<User>>& reviewers) override;
-
-    /**
-     * @brief Handle the review process for articles within the track.
-     * @param articles The articles to review.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewMap A map of articles and their associated reviews.
-     * @param averageRatings A map of articles and their average ratings.
-     * @param reviewers The reviewers conducting the reviews.
-     *
-     * Manages the review process for articles in the track, ensuring that articles are reviewed and rated by the
-     * reviewers.
-     */
-    void handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                      const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                      std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                      std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                      const std::vector<std::shared_ptr<User>>& reviewers) override;
-
-    /**
-     * @brief Handle the selection of articles based on the provided parameters.
-     * @param selectedArticles A vector of shared pointers to the selected articles.
-     * @param selectionStrategy A shared pointer to the selection strategy to be used.
-     * @param ratingMap An unordered map that maps articles to their corresponding ratings.
-     * @param selectionThreshold An integer representing the number of articles to be selected.
-     *
-     * Manages the selection process for articles in the track, determining which articles are selected based on the
-     * provided strategy and ratings.
-     */
-    void handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                         std::shared_ptr<SelectionStrategy> selectionStrategy,
-                         std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                         int selectionThreshold) override;
-
-    /**
-     * @brief Get the state's name.
-     * @return A constant reference to a string representing the state's name.
-     *
-     * Returns the name of the current state.
-     */
-    const std::string& stateName() override;
-
-  private:
-    std::string m_stateName{"Bidding"}; /**< The name of the current state. */
-
-    /**
-     * @brief Update the bidding interest for an article in the track.
-     * @param interestMap A map of articles and their corresponding bids.
-     * @param article The article to update.
-     * @param interest The new bidding interest to set.
-     *
-     * Updates the bidding interest for the specified article within the track.
-     */
-    void updateBidding(std::unordered_map<std::shared_ptr<Article>, Bid>& interestMap,
-                       const std::shared_ptr<Article>& article, BiddingInterest interest);
-
-    /**
-     * @brief Remove the bidding interest for an article from the map.
-     * @param interestMap A map of articles and their corresponding bids.
-     * @param article The article to remove.
-     * @param interest The bidding interest to remove.
-     *
-     * Removes the bidding interest for the specified article from the map.
-     */
-    void removeBidding(std::unordered_map<std::shared_ptr<Article>, Bid>& interestMap,
-                       const std::shared_ptr<Article>& article, BiddingInterest interest);
+                       std::uint64_t trackKey,
+                       BidMatrix& biddingMatrix,
+                       const std::vector<std::shared_ptr<User>>& reviewers) const;
 };
 
 #endif // TRACK_STATE_BIDDING_HPP
@@ -9,104 +9,80 @@
 #ifndef TRACK_STATE_RECEPTION_HPP
 #define TRACK_STATE_RECEPTION_HPP
 
-#include "bid.hpp"
 #include "itrackState.hpp"
-#include "track.hpp"
+#include <string_view>
 
 /**
  * @class ReceptionStateTrack
  * @brief Represents the reception state of a track in the conference.
  *
- * The ReceptionStateTrack class implements the ITrackState interface to provide
- * functionalities specific to the reception state of a track. It handles operations
- * such as adding articles, managing bids, and processing reviews and selections.
+ * The ReceptionStateTrack class is the phase of a track in which articles are submitted,
+ * updated and withdrawn. It is one of the alternatives of TrackPhase and holds no data: it
+ * only implements the operation allowed in its phase, and names why each of the other
+ * operations is rejected.
  */
-class ReceptionStateTrack : public ITrackState
+class ReceptionStateTrack
 {
   public:
+    /** The name of the state. */
+    static constexpr std::string_view NAME = "Reception";
+
+    /** Why bidding is rejected. */
+    static constexpr std::string_view BIDDING_REJECTION = "Bidding is not allowed in reception state";
+
+    /** Why review is rejected. */
+    static constexpr std::string_view REVIEW_REJECTION = "Review is not allowed in reception state";
+
+    /** Why selection is rejected. */
+    static constexpr std::string_view SELECTION_REJECTION = "Cannot handle selection in Reception state";
+
     /**
      * @brief Handle an article within the track in the reception state.
-     * @param articles The list of articles to modify.
+     * @param articles The title-indexed articles of the track.
      * @param article The article to handle.
      * @param operation The operation to perform (Create, Update, Delete).
+     * @return DuplicateArticle when creating an article whose title is already present in the track,
+     * ArticleNotFound when updating or deleting an article the track does not hold.
      *
      * Manages the specified article within the track based on the operation type during the reception state.
      */
-    void handleArticle(std::vector<std::shared_ptr<Article>>& articles, const std::shared_ptr<Article>& article,
-                       OperationType operation) override;
+    TrackResult handleArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article,
+                              OperationType operation) const;
 
     /**
-     * @brief Handle the bidding process for articles within the track.
-     * @param articles The articles to bid on.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewers The reviewers participating in the bidding process.
+     * @brief Handle a batch of articles within the track in the reception state.
+     * @param articles The title-indexed articles of the track.
+     * @param submissions The articles to handle.
+     * @param operation The operation to perform on every article (Create, Update, Delete).
+     * @param results The outcome of each article, by position in the batch.
      *
-     * Manages the bidding process for articles in the track, associating articles with bids made by reviewers.
+     * Handles the articles whose result holds no error yet, in order, as handleArticle would, and
+     * stores the outcome of each one. Creating articles reserves room for the whole batch first, so
+     * the storage and the title index grow at most once.
      */
-    void handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                       std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                       const std::vector<std::shared_ptr<User>>& reviewers) override;
-
-    /**
-     * @brief Handle the review process for articles within the track.
-     * @param articles The articles to review.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewMap A map of articles and their associated reviews.
-     * @param averageRatings A map of articles and their average ratings.
-     * @param reviewers The reviewers conducting the reviews.
-     *
-     * Manages the review process for articles in the track, ensuring that articles are reviewed and rated by the
-     * reviewers.
-     */
-    void handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                      const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                      std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                      std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                      const std::vector<std::shared_ptr<User>>& reviewers) override;
-
-    /**
-     * @brief Handle the selection of articles based on the provided parameters.
-     * @param selectedArticles A vector of shared pointers to the selected articles.
-     * @param selectionStrategy A shared pointer to the selection strategy to be used.
-     * @param ratingMap An unordered map that maps articles to their corresponding ratings.
-     * @param selectionThreshold An integer representing the number of articles to be selected.
-     *
-     * Manages the selection process for articles in the track, determining which articles are selected based on the
-     * provided strategy and ratings.
-     */
-    void handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                         std::shared_ptr<SelectionStrategy> selectionStrategy,
-                         std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                         int selectionThreshold) override;
-
-    /**
-     * @brief Get the state's name.
-     * @return A constant reference to a string representing the state's name.
-     *
-     * Returns the name of the current state.
-     */
-    const std::string& stateName() override;
+    void handleArticles(ArticleIndex& articles, std::span<const std::shared_ptr<Article>> submissions,
+                        OperationType operation, std::span<TrackResult> results) const;
 
   private:
-    std::string m_stateName{"Reception"}; /**< The name of the current state. */
-
     /**
      * @brief Update an article in the track.
-     * @param articles The list of articles to modify.
+     * @param articles The title-indexed articles of the track.
      * @param article The article to update.
+     * @return ArticleNotFound if the track holds no article with the title.
      *
-     * Updates the specified article within the track.
+     * Updates the article with the same title within the track, looking it up through the title index.
      */
-    void updateArticle(std::vector<std::shared_ptr<Article>>& articles, const std::shared_ptr<Article>& article);
+    static TrackResult updateArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article);
 
     /**
      * @brief Remove an article from the track.
-     * @param articles The list of articles to modify.
+     * @param articles The title-indexed articles of the track.
      * @param article The article to remove.
+     * @return ArticleNotFound if the track holds no article with the title.
      *
-     * Removes the specified article from the track.
+     * Removes the article with the same title from the track, looking it up through the title index.
      */
-    void removeArticle(std::vector<std::shared_ptr<Article>>& articles, const std::shared_ptr<Article>& article);
+    static TrackResult removeArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article);
 };
 
 #endif // TRACK_STATE_RECEPTION_HPP
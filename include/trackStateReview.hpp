@@ -9,86 +9,96 @@
 #ifndef TRACK_STATE_REVIEW_HPP
 #define TRACK_STATE_REVIEW_HPP
 
-#include "bid.hpp"
 #include "itrackState.hpp"
-#include "track.hpp"
+#include <cstdint>
+#include <string_view>
 
 /**
  * @class ReviewStateTrack
  * @brief Represents the review state of a track in the conference.
  *
- * The ReviewStateTrack class implements the ITrackState interface to provide
- * functionalities specific to the review state of a track. It handles operations
- * such as adding articles, managing bids, and processing reviews and selections.
+ * The ReviewStateTrack class is the phase of a track in which the articles are assigned to
+ * reviewers and reviewed. It is one of the alternatives of TrackPhase and holds no data: it
+ * only implements the operation allowed in its phase, and names why each of the other
+ * operations is rejected.
  */
-class ReviewStateTrack : public ITrackState
+class ReviewStateTrack
 {
   public:
-    /**
-     * @brief Handle an article within the track in the review state.
-     * @param articles The list of articles to modify.
-     * @param article The article to handle.
-     * @param operation The operation to perform (Create, Update, Delete).
-     *
-     * Manages the specified article within the track based on the operation type during the review state.
-     */
-    void handleArticle(std::vector<std::shared_ptr<Article>>& articles, const std::shared_ptr<Article>& article,
-                       OperationType operation) override;
+    /** The name of the state. */
+    static constexpr std::string_view NAME = "Review";
 
-    /**
-     * @brief Handle the bidding process for articles within the track.
-     * @param articles The articles to bid on.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewers The reviewers participating in the bidding process.
-     *
-     * Manages the bidding process for articles in the track, associating articles with bids made by reviewers.
-     */
-    void handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                       std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                       const std::vector<std::shared_ptr<User>>& reviewers) override;
+    /** Why articles are rejected. */
+    static constexpr std::string_view ARTICLE_REJECTION = "Cannot handle articles in review state";
+
+    /** Why bidding is rejected. */
+    static constexpr std::string_view BIDDING_REJECTION = "Bidding is not allowed in review state";
+
+    /** Why selection is rejected. */
+    static constexpr std::string_view SELECTION_REJECTION = "Cannot handle selection in review state";
 
     /**
      * @brief Handle the review process for articles within the track.
      * @param articles The articles to review.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewMap A map of articles and their associated reviews.
-     * @param averageRatings A map of articles and their average ratings.
+     * @param trackKey The key of the track, mixed into the key of each article so the decisions on articles
+     * sharing a title in other tracks are drawn independently.
+     * @param biddingMatrix The bids of every reviewer on every article.
+     * @param assignmentStrategy The strategy deciding which reviewer reviews which article.
+     * @param conflicts The affiliations of the people of the conference, masking the conflicts of interest.
+     * @param reviews The reviews of the track, listed by article and by reviewer id.
+     * @param scores The live ranking of the articles, holding their aggregated reviews by article id.
      * @param reviewers The reviewers conducting the reviews.
+     * @param sink The sink receiving the average rating of each newly reviewed article.
+     * @param arena The memory of the phase, holding the conflict mask, the assignments and the scratch of the
+     * assignment strategy until the phase is over.
      *
      * Manages the review process for articles in the track, ensuring that articles are reviewed and rated by the
-     * reviewers.
+     * reviewers. Reviewers in conflict of interest with an article are masked out of the assignment, and the
+     * number of masked pairs is reported. Each reviewer writes its review straight into the store, and the review
+     * is folded into the scores as soon as it arrives. The reviews an article already holds, whether submitted
+     * on their own or collected by an earlier run, count against its quota: articles holding their quota are left
+     * out of the assignment, the others only receive their missing reviews, from reviewers who did not review
+     * them yet. A run with nothing left to review returns without computing an assignment.
      */
     void handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                      const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                      std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                      std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                      const std::vector<std::shared_ptr<User>>& reviewers) override;
+                      std::uint64_t trackKey,
+                      const BidMatrix& biddingMatrix,
+                      const std::shared_ptr<AssignmentStrategy>& assignmentStrategy,
+                      const ConflictIndex& conflicts,
+                      ReviewStore& reviews,
+                      Leaderboard& scores,
+                      const std::vector<std::shared_ptr<User>>& reviewers,
+                      ReportSink& sink,
+                      std::pmr::memory_resource& arena) const;
 
     /**
-     * @brief Handle the selection of articles based on the provided parameters.
-     * @param selectedArticles A vector of shared pointers to the selected articles.
-     * @param selectionStrategy A shared pointer to the selection strategy to be used.
-     * @param ratingMap An unordered map that maps articles to their corresponding ratings.
-     * @param selectionThreshold An integer representing the number of articles to be selected.
+     * @brief Add one review to an article.
+     * @param articles The articles of the track.
+     * @param article The id of the reviewed article.
+     * @param review The review.
+     * @param reviews The reviews of the track, receiving the review without a reviewer.
+     * @param scores The live ranking of the articles, holding their aggregated reviews by article id.
+     * @param sink The sink receiving the new average rating of the article.
+     * @return ArticleNotFound if the id is not the id of an article of the track.
      *
-     * Manages the selection process for articles in the track, determining which articles are selected based on the
-     * provided strategy and ratings.
+     * Appends the review and folds it into the aggregate of the article in O(1), so the ratings of the track can be
+     * polled during the whole review phase without recomputing them.
      */
-    void handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                         std::shared_ptr<SelectionStrategy> selectionStrategy,
-                         std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                         int selectionThreshold) override;
+    TrackResult submitReview(const std::vector<std::shared_ptr<Article>>& articles,
+                             ArticleId article,
+                             const Review& review,
+                             ReviewStore& reviews,
+                             Leaderboard& scores,
+                             ReportSink& sink) const;
 
+  private:
     /**
-     * @brief Get the state's name.
-     * @return A constant reference to a string representing the state's name.
-     *
-     * Returns the name of the current state.
+     * @brief Report the average rating of an article.
+     * @param article The article.
+     * @param score The aggregated reviews of the article.
+     * @param sink The sink receiving the rating.
      */
-    const std::string& stateName() override;
-
-  private:
-    std::string m_stateName{"Review"}; /**< The name of the current state. */
+    static void reportRating(const Article& article, const ReviewAggregate& score, ReportSink& sink);
 };
 
 #endif // TRACK_STATE_REVIEW_HPP
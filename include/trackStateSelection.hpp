@@ -10,85 +10,46 @@
 #define TRACK_STATE_SELECTION_HPP
 
 #include "itrackState.hpp"
-#include "review.hpp"
-#include "selectionStrategy.hpp"
+#include <string_view>
 
 /**
  * @class SelectionStateTrack
  * @brief Represents the selection state of a track in the conference.
  *
- * The SelectionStateTrack class implements the ITrackState interface to provide
- * functionalities specific to the selection state of a track. It handles operations
- * such as adding articles, managing bids, and processing reviews and selections.
+ * The SelectionStateTrack class is the phase of a track in which the best reviewed articles
+ * are selected. It is one of the alternatives of TrackPhase and holds no data: it only
+ * implements the operation allowed in its phase, and names why each of the other operations
+ * is rejected.
  */
-class SelectionStateTrack : public ITrackState
+class SelectionStateTrack
 {
   public:
-    /**
-     * @brief Handle an article within the track in the selection state.
-     * @param articles The list of articles to modify.
-     * @param article The article to handle.
-     * @param operation The operation to perform (Create, Update, Delete).
-     *
-     * Manages the specified article within the track based on the operation type during the selection state.
-     */
-    void handleArticle(std::vector<std::shared_ptr<Article>>& articles, const std::shared_ptr<Article>& article,
-                       OperationType operation) override;
+    /** The name of the state. */
+    static constexpr std::string_view NAME = "Selection";
 
-    /**
-     * @brief Handle the bidding process for articles within the track.
-     * @param articles The articles to bid on.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewers The reviewers participating in the bidding process.
-     *
-     * Manages the bidding process for articles in the track, associating articles with bids made by reviewers.
-     */
-    void handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                       std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                       const std::vector<std::shared_ptr<User>>& reviewers) override;
+    /** Why articles are rejected. */
+    static constexpr std::string_view ARTICLE_REJECTION = "Cannot handle articles in selection state";
 
-    /**
-     * @brief Handle the review process for articles within the track.
-     * @param articles The articles to review.
-     * @param biddingMap A map of articles and their corresponding bids.
-     * @param reviewMap A map of articles and their associated reviews.
-     * @param averageRatings A map of articles and their average ratings.
-     * @param reviewers The reviewers conducting the reviews.
-     *
-     * Manages the review process for articles in the track, ensuring that articles are reviewed and rated by the
-     * reviewers.
-     */
-    void handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                      const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                      std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                      std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                      const std::vector<std::shared_ptr<User>>& reviewers) override;
+    /** Why bidding is rejected. */
+    static constexpr std::string_view BIDDING_REJECTION = "Bidding is not allowed in selection state";
+
+    /** Why review is rejected. */
+    static constexpr std::string_view REVIEW_REJECTION = "Review is not allowed in selection state";
 
     /**
      * @brief Handle the selection of articles based on the provided parameters.
-     * @param selectedArticles A vector of shared pointers to the selected articles.
+     * @param selectedArticles The ids of the selected articles.
      * @param selectionStrategy A shared pointer to the selection strategy to be used.
-     * @param ratingMap An unordered map that maps articles to their corresponding ratings.
+     * @param scores The live ranking of the articles, holding their aggregated reviews by article id.
      * @param selectionThreshold An integer representing the number of articles to be selected.
      *
      * Manages the selection process for articles in the track, determining which articles are selected based on the
      * provided strategy and ratings.
      */
-    void handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                         std::shared_ptr<SelectionStrategy> selectionStrategy,
-                         std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                         int selectionThreshold) override;
-
-    /**
-     * @brief Get the state's name.
-     * @return A constant reference to a string representing the state's name.
-     *
-     * Returns the name of the current state.
-     */
-    const std::string& stateName() override;
-
-  private:
-    std::string m_stateName{"Selection"}; /**< The name of the current state. */
+    void handleSelection(std::vector<ArticleId>& selectedArticles,
+                         const std::shared_ptr<SelectionStrategy>& selectionStrategy,
+                         const Leaderboard& scores,
+                         int selectionThreshold) const;
 };
 
 #endif // TRACK_STATE_SELECTION_HPP
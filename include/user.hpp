@@ -10,8 +10,12 @@
 #define USER_HPP
 
 #include "bid.hpp"
+#include "bidMatrix.hpp"
+#include "identifiers.hpp"
 #include "nlohmann/json.hpp"
 #include "review.hpp"
+#include "reviewStore.hpp"
+#include <cstdint>
 #include <string>
 
 /**
@@ -122,7 +126,68 @@ class User
         throw std::runtime_error("Not implemented for Users");
     };
 
+    /**
+     * @brief Determine the user's interest in a given article.
+     * @param event A stable key of the article the interest is about.
+     * @return A Bid object representing the user's interest in the article.
+     *
+     * Derived classes simulating their decisions must make the result depend only on
+     * the user and the event, so bids can be placed from any thread in any order.
+     */
+    virtual Bid determineInterest(std::uint64_t /*event*/)
+    {
+        throw std::runtime_error("Not implemented for Users");
+    };
+
+    /**
+     * @brief Determine the user's interest in a given article into the bids of a track.
+     * @param event A stable key of the article the interest is about.
+     * @param bids The bids of the track, receiving the interest.
+     * @param reviewer The id of the user among the reviewers of the track.
+     * @param article The id of the article in the track.
+     *
+     * Derived classes must draw the same interest as determineInterest(event), writing it in the
+     * cell of the track instead of building a standalone Bid, so bidding allocates nothing per cell.
+     */
+    virtual void determineInterest(std::uint64_t /*event*/, BidMatrix& /*bids*/, ReviewerId /*reviewer*/,
+                                   ArticleId /*article*/)
+    {
+        throw std::runtime_error("Not implemented for Users");
+    };
+
+    /**
+     * @brief Review a given article.
+     * @param event A stable key of the article being reviewed.
+     * @return A Review object containing the user's review of the article.
+     *
+     * Derived classes simulating their decisions must make the result depend only on
+     * the user and the event, so reviews can be written from any thread in any order.
+     */
+    virtual Review reviewArticle(std::uint64_t /*event*/)
+    {
+        throw std::runtime_error("Not implemented for Users");
+    };
+
+    /**
+     * @brief Review a given article into the reviews of a track.
+     * @param event A stable key of the article being reviewed.
+     * @param reviews The reviews of the track, receiving the review.
+     * @param reviewer The id of the user among the reviewers of the track.
+     * @param article The id of the article in the track.
+     * @return The index of the review in the store.
+     *
+     * Derived classes must draw the same review as reviewArticle(event), storing it in the
+     * track instead of building a standalone Review, so the review phase does not copy it.
+     */
+    virtual std::uint32_t reviewArticle(std::uint64_t /*event*/, ReviewStore& /*reviews*/, ReviewerId /*reviewer*/,
+                                        ArticleId /*article*/)
+    {
+        throw std::runtime_error("Not implemented for Users");
+    };
+
   protected:
+    friend class ConferenceSnapshot;
+
     std::string m_fullNames;   /**< The full name of the user. */
     std::string m_affiliation; /**< The affiliation of the user. */
     std::string m_email;       /**< The email of the user. */
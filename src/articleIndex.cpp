@@ -0,0 +1,67 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "articleIndex.hpp"
+
+bool ArticleIndex::insert(const std::shared_ptr<Article>& article)
+{
+    const auto [it, inserted] = m_positions.try_emplace(article->articleName(), m_articles.size());
+    if (!inserted)
+    {
+        return false;
+    }
+    m_articles.push_back(article);
+    return true;
+}
+
+Article* ArticleIndex::find(std::string_view title) const
+{
+    const auto it = m_positions.find(title);
+    return it == m_positions.end() ? nullptr : m_articles[it->second].get();
+}
+
+bool ArticleIndex::erase(std::string_view title)
+{
+    const auto it = m_positions.find(title);
+    if (it == m_positions.end())
+    {
+        return false;
+    }
+
+    // Fill the hole with the last article to keep the storage contiguous
+    const auto position = it->second;
+    m_positions.erase(it);
+    if (position != m_articles.size() - 1)
+    {
+        m_articles[position] = std::move(m_articles.back());
+        m_positions.find(m_articles[position]->articleName())->second = position;
+    }
+    m_articles.pop_back();
+    return true;
+}
+
+void ArticleIndex::reserve(size_t capacity)
+{
+    m_articles.reserve(capacity);
+    m_positions.reserve(capacity);
+}
+
+size_t ArticleIndex::size() const
+{
+    return m_articles.size();
+}
+
+bool ArticleIndex::empty() const
+{
+    return m_articles.empty();
+}
+
+const std::vector<std::shared_ptr<Article>>& ArticleIndex::articles() const
+{
+    return m_articles;
+}
@@ -7,7 +7,8 @@
  */
 
 #include "articleInterface.hpp"
-#include <iostream>
+#include <iterator>
+#include <utility>
 
 Article::Article(const nlohmann::json& articleJson)
 {
@@ -16,6 +17,21 @@ Article::Article(const nlohmann::json& articleJson)
     m_authors = articleJson.value("authors", std::vector<std::string>());
 }
 
+Article::Article(std::string title, std::string attachedUrl, std::vector<std::string> authors)
+    : m_title(std::move(title)), m_attachedUrl(std::move(attachedUrl)), m_authors(std::move(authors))
+{
+}
+
+const std::string& Article::attachedUrl() const
+{
+    return m_attachedUrl;
+}
+
+const std::vector<std::string>& Article::authors() const
+{
+    return m_authors;
+}
+
 void Article::updateFields(const std::shared_ptr<Article>& article)
 {
     m_title = article->m_title;
@@ -23,18 +39,22 @@ void Article::updateFields(const std::shared_ptr<Article>& article)
     m_authors = article->m_authors;
 }
 
-void Article::display() const
+void Article::display(ReportSink& sink) const
+{
+    sink.report("article", "Title: {}\nAuthors: {}\nAttached URL: {}",
+                {{"title", m_title}, {"authors", authorList()}, {"attachedUrl", m_attachedUrl}});
+}
+
+std::string Article::authorList() const
 {
-    std::cout << "Title: " << m_title << std::endl;
-    std::cout << "Authors: ";
+    std::string authors;
     for (auto it = m_authors.begin(); it != m_authors.end(); ++it)
     {
-        std::cout << *it;
+        authors += *it;
         if (it != std::prev(m_authors.end()))
         {
-            std::cout << ", ";
+            authors += ", ";
         }
     }
-    std::cout << std::endl;
-    std::cout << "Attached URL: " << m_attachedUrl << std::endl;
+    return authors;
 }
@@ -7,24 +7,33 @@
  */
 
 #include "articlePoster.hpp"
-#include <iostream>
+#include <utility>
 
 ArticlePoster::ArticlePoster(const nlohmann::json& articleJson) : Article(articleJson)
 {
     m_secondAttach = articleJson.value("additionalFileUrl", "");
 }
 
+ArticlePoster::ArticlePoster(std::string title, std::string attachedUrl, std::vector<std::string> authors,
+                             std::string secondAttachment)
+    : Article(std::move(title), std::move(attachedUrl), std::move(authors)),
+      m_secondAttach(std::move(secondAttachment))
+{
+}
+
 void ArticlePoster::updateFields(const std::shared_ptr<Article>& article)
 {
     Article::updateFields(article);
     m_secondAttach = std::static_pointer_cast<ArticlePoster>(article)->m_secondAttach;
 }
 
-void ArticlePoster::display() const
+void ArticlePoster::display(ReportSink& sink) const
 {
-    std::cout << "=== Poster ===" << std::endl;
-    Article::display();
-    std::cout << "Second Attachment: " << m_secondAttach << std::endl;
+    sink.report("poster", "=== Poster ===\nTitle: {}\nAuthors: {}\nAttached URL: {}\nSecond Attachment: {}",
+                {{"title", m_title},
+                 {"authors", authorList()},
+                 {"attachedUrl", m_attachedUrl},
+                 {"secondAttachment", m_secondAttach}});
 }
 
 bool ArticlePoster::isValid() const
@@ -36,3 +45,8 @@ const std::string& ArticlePoster::articleName() const
 {
     return m_title;
 }
+
+const std::string& ArticlePoster::secondAttachment() const
+{
+    return m_secondAttach;
+}
@@ -7,7 +7,7 @@
  */
 
 #include "articleRegular.hpp"
-#include <iostream>
+#include <utility>
 
 constexpr auto MINIMUM_ABSTRACT_SIZE = 10; // Minimum size for an abstract. Set to 10 for testing purposes.
 
@@ -16,17 +16,25 @@ ArticleRegular::ArticleRegular(const nlohmann::json& articleJson) : Article(arti
     m_abstract = articleJson.value("abstract", "");
 }
 
+ArticleRegular::ArticleRegular(std::string title, std::string attachedUrl, std::vector<std::string> authors,
+                               std::string abstract)
+    : Article(std::move(title), std::move(attachedUrl), std::move(authors)), m_abstract(std::move(abstract))
+{
+}
+
 void ArticleRegular::updateFields(const std::shared_ptr<Article>& article)
 {
     Article::updateFields(article);
     m_abstract = std::static_pointer_cast<ArticleRegular>(article)->m_abstract;
 }
 
-void ArticleRegular::display() const
+void ArticleRegular::display(ReportSink& sink) const
 {
-    std::cout << "=== Article ===" << std::endl;
-    Article::display();
-    std::cout << "Abstract: " << m_abstract << std::endl;
+    sink.report("article", "=== Article ===\nTitle: {}\nAuthors: {}\nAttached URL: {}\nAbstract: {}",
+                {{"title", m_title},
+                 {"authors", authorList()},
+                 {"attachedUrl", m_attachedUrl},
+                 {"abstract", m_abstract}});
 }
 
 bool ArticleRegular::isValid() const
@@ -39,3 +47,8 @@ const std::string& ArticleRegular::articleName() const
 {
     return m_title;
 }
+
+const std::string& ArticleRegular::abstract() const
+{
+    return m_abstract;
+}
@@ -0,0 +1,475 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "assignmentStrategyOptimal.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace
+{
+constexpr std::int64_t MAX_AFFINITY = 3;
+constexpr std::array<std::uint32_t, 4> AFFINITY{1, 0, 2, 3}; // Indexed by BiddingInterest
+constexpr auto UNREACHABLE = std::numeric_limits<std::int64_t>::max();
+constexpr auto NO_NODE = std::numeric_limits<std::uint32_t>::max();
+constexpr std::int32_t NO_LEVEL = -1;
+
+/**
+ * @class AssignmentNetwork
+ * @brief Residual network of the reviewer assignment problem.
+ *
+ * Nodes are the articles [0, A), the reviewers [A, A + R) and the sink A + R. The source is
+ * implicit: every article still missing reviews is a starting point. Edges are never stored,
+ * they are derived from the bid matrix and the current assignment, in which the reviews the
+ * articles already hold count against their quota and block their pair without being movable:
+ *  - article -> reviewer while the pair is unassigned and not in conflict, costing the inverse of the affinity;
+ *  - reviewer -> article for every assigned pair, with the opposite cost;
+ *  - reviewer -> sink while the reviewer has room for another article, costing nothing.
+ *
+ * The network only lives while the assignment is computed, so all of its state is allocated from
+ * the resource it is given, and none of it is freed before the network is.
+ */
+class AssignmentNetwork
+{
+  public:
+    AssignmentNetwork(const BidMatrix& bids, const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed,
+                      std::uint32_t quota, std::pmr::memory_resource* resource)
+        : m_bids{bids}, m_conflicts{conflicts}, m_articles{static_cast<std::uint32_t>(bids.articles())},
+          m_reviewers{static_cast<std::uint32_t>(bids.reviewers())}, m_sink{m_articles + m_reviewers}, m_quota{quota},
+          m_assignedBits((bids.size() + 63) / 64, 0, resource), m_assigned(m_reviewers, resource),
+          m_taken(m_articles, 0, resource), m_potential(m_sink + 1, 0, resource), m_distance(m_sink + 1, resource),
+          m_level(m_sink + 1, resource), m_arc(m_sink + 1, resource), m_queue(resource), m_path(resource),
+          m_heap(resource)
+    {
+        // Earlier reviews are only marked in the bits, so no path ever hands them over to another reviewer
+        for (const auto& review : reviewed)
+        {
+            ++m_taken[review.article];
+            if (review.reviewer < m_reviewers)
+            {
+                const auto index = cell(review.reviewer, review.article);
+                m_assignedBits[index / 64] |= std::uint64_t{1} << (index % 64);
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of reviews the articles are still missing.
+     * @return The sum over the articles of their quota minus the reviews they hold.
+     */
+    size_t missing() const
+    {
+        size_t reviews = 0;
+        for (const auto taken : m_taken)
+        {
+            reviews += m_quota - std::min(taken, m_quota);
+        }
+        return reviews;
+    }
+
+    /**
+     * @brief Set the maximum number of new reviews per reviewer.
+     * @param capacity The capacity of every reviewer.
+     */
+    void capacity(std::uint32_t capacity)
+    {
+        m_capacity = capacity;
+    }
+
+    /**
+     * @brief Run Dijkstra on reduced costs and shift the potentials by the distances found.
+     * @return True if the sink is still reachable, false once no more reviews can be assigned.
+     *
+     * Distances beyond the one of the sink are clamped to it, which keeps every reduced cost
+     * non-negative and turns every shortest augmenting path into a zero reduced cost path.
+     * The heap of the search is kept from a call to the next, so it is only grown, never reallocated
+     * from scratch.
+     */
+    bool updatePotentials()
+    {
+        const auto push = [&](std::int64_t distance, std::uint32_t node) {
+            m_heap.emplace_back(distance, node);
+            std::push_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+        };
+        m_heap.clear();
+        std::fill(m_distance.begin(), m_distance.end(), UNREACHABLE);
+        for (std::uint32_t article = 0; article < m_articles; ++article)
+        {
+            if (m_taken[article] < m_quota)
+            {
+                m_distance[article] = 0;
+                push(0, article);
+            }
+        }
+
+        while (!m_heap.empty())
+        {
+            std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+            const auto [distance, node] = m_heap.back();
+            m_heap.pop_back();
+            if (distance > m_distance[node])
+            {
+                continue;
+            }
+            if (node == m_sink)
+            {
+                break;
+            }
+
+            const auto relax = [&](std::uint32_t next, std::int64_t reducedCost) {
+                const auto candidate = distance + reducedCost;
+                if (candidate < m_distance[next])
+                {
+                    m_distance[next] = candidate;
+                    push(candidate, next);
+                }
+            };
+
+            if (node < m_articles)
+            {
+                for (std::uint32_t reviewer = 0; reviewer < m_reviewers; ++reviewer)
+                {
+                    if (available(reviewer, node))
+                    {
+                        relax(m_articles + reviewer, reducedCost(node, reviewer));
+                    }
+                }
+            }
+            else
+            {
+                const auto reviewer = node - m_articles;
+                if (m_assigned[reviewer].size() < m_capacity)
+                {
+                    relax(m_sink, m_potential[node] - m_potential[m_sink]);
+                }
+                for (const auto article : m_assigned[reviewer])
+                {
+                    relax(article, -reducedCost(article, reviewer));
+                }
+            }
+        }
+
+        if (m_distance[m_sink] == UNREACHABLE)
+        {
+            return false;
+        }
+
+        const auto limit = m_distance[m_sink];
+        for (size_t node = 0; node < m_potential.size(); ++node)
+        {
+            m_potential[node] += std::min(m_distance[node], limit);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Layer the zero reduced cost edges by their distance in hops from the source.
+     * @return True if the sink can be reached through zero reduced cost edges.
+     */
+    bool buildLevels()
+    {
+        std::fill(m_level.begin(), m_level.end(), NO_LEVEL);
+        m_queue.clear();
+        for (std::uint32_t article = 0; article < m_articles; ++article)
+        {
+            if (m_taken[article] < m_quota)
+            {
+                m_level[article] = 0;
+                m_queue.push_back(article);
+            }
+        }
+
+        const auto visit = [&](std::uint32_t node, std::uint32_t next) {
+            if (m_level[next] == NO_LEVEL)
+            {
+                m_level[next] = m_level[node] + 1;
+                m_queue.push_back(next);
+            }
+        };
+
+        for (size_t head = 0; head < m_queue.size(); ++head)
+        {
+            const auto node = m_queue[head];
+            if (m_level[m_sink] != NO_LEVEL && m_level[node] >= m_level[m_sink])
+            {
+                break;
+            }
+
+            if (node < m_articles)
+            {
+                for (std::uint32_t reviewer = 0; reviewer < m_reviewers; ++reviewer)
+                {
+                    if (available(reviewer, node) && reducedCost(node, reviewer) == 0)
+                    {
+                        visit(node, m_articles + reviewer);
+                    }
+                }
+            }
+            else
+            {
+                const auto reviewer = node - m_articles;
+                if (m_assigned[reviewer].size() < m_capacity && m_potential[node] == m_potential[m_sink])
+                {
+                    visit(node, m_sink);
+                }
+                for (const auto article : m_assigned[reviewer])
+                {
+                    if (reducedCost(article, reviewer) == 0)
+                    {
+                        visit(node, article);
+                    }
+                }
+            }
+        }
+        return m_level[m_sink] != NO_LEVEL;
+    }
+
+    /**
+     * @brief Augment along level-increasing zero reduced cost paths until none is left.
+     */
+    void blockingFlow()
+    {
+        std::fill(m_arc.begin(), m_arc.end(), 0);
+        for (std::uint32_t article = 0; article < m_articles; ++article)
+        {
+            while (m_level[article] == 0 && m_taken[article] < m_quota && augment(article))
+            {
+            }
+        }
+    }
+
+    /**
+     * @brief Collect the assigned pairs.
+     * @param assignments The vector to store the assignments, sorted by article and reviewer.
+     */
+    void collect(std::pmr::vector<ReviewAssignment>& assignments) const
+    {
+        for (std::uint32_t reviewer = 0; reviewer < m_reviewers; ++reviewer)
+        {
+            for (const auto article : m_assigned[reviewer])
+            {
+                assignments.push_back({reviewer, article});
+            }
+        }
+        std::sort(assignments.begin(), assignments.end(), [](const ReviewAssignment& a, const ReviewAssignment& b) {
+            return a.article != b.article ? a.article < b.article : a.reviewer < b.reviewer;
+        });
+    }
+
+  private:
+    /** An entry of the Dijkstra heap, a distance and its node. */
+    using HeapEntry = std::pair<std::int64_t, std::uint32_t>;
+
+    size_t cell(std::uint32_t reviewer, std::uint32_t article) const
+    {
+        return static_cast<size_t>(article) * m_reviewers + reviewer;
+    }
+
+    bool assigned(std::uint32_t reviewer, std::uint32_t article) const
+    {
+        const auto index = cell(reviewer, article);
+        return (m_assignedBits[index / 64] >> (index % 64)) & 1U;
+    }
+
+    /**
+     * @brief Check whether the edge from an article to a reviewer exists.
+     * @return True if the pair is neither assigned nor in conflict.
+     */
+    bool available(std::uint32_t reviewer, std::uint32_t article) const
+    {
+        return !assigned(reviewer, article) && !m_conflicts.conflicted(reviewer, article);
+    }
+
+    /**
+     * @brief Get the reduced cost of the edge from an article to a reviewer.
+     */
+    std::int64_t reducedCost(std::uint32_t article, std::uint32_t reviewer) const
+    {
+        const auto interest = static_cast<size_t>(m_bids.at(reviewer, article));
+        return MAX_AFFINITY - AFFINITY[interest] + m_potential[article] - m_potential[m_articles + reviewer];
+    }
+
+    /**
+     * @brief Find the next admissible edge leaving a node, starting from its current arc.
+     * @return The head of the edge, or NO_NODE if the node is a dead end.
+     */
+    std::uint32_t nextEdge(std::uint32_t node)
+    {
+        const auto level = m_level[node] + 1;
+        auto& arc = m_arc[node];
+        if (node < m_articles)
+        {
+            for (; arc < m_reviewers; ++arc)
+            {
+                if (m_level[m_articles + arc] == level && available(arc, node) && reducedCost(node, arc) == 0)
+                {
+                    return m_articles + arc;
+                }
+            }
+            return NO_NODE;
+        }
+
+        // Arc 0 is the edge to the sink, arc i > 0 the edge back to the i-th assigned article
+        const auto reviewer = node - m_articles;
+        const auto& assignedArticles = m_assigned[reviewer];
+        if (arc == 0)
+        {
+            if (m_level[m_sink] == level && assignedArticles.size() < m_capacity &&
+                m_potential[node] == m_potential[m_sink])
+            {
+                return m_sink;
+            }
+            ++arc;
+        }
+        for (; arc <= assignedArticles.size(); ++arc)
+        {
+            const auto article = assignedArticles[arc - 1];
+            if (m_level[article] == level && reducedCost(article, reviewer) == 0)
+            {
+                return article;
+            }
+        }
+        return NO_NODE;
+    }
+
+    /**
+     * @brief Search an augmenting path from an article and push one review along it.
+     * @return True if a path to the sink was found.
+     */
+    bool augment(std::uint32_t source)
+    {
+        m_path.clear();
+        m_path.push_back(source);
+        while (!m_path.empty())
+        {
+            const auto node = m_path.back();
+            if (node == m_sink)
+            {
+                apply();
+                return true;
+            }
+
+            const auto next = nextEdge(node);
+            if (next != NO_NODE)
+            {
+                m_path.push_back(next);
+                continue;
+            }
+
+            // Dead end: drop the node from the level graph and skip the edge that led to it
+            m_level[node] = NO_LEVEL;
+            m_path.pop_back();
+            if (!m_path.empty())
+            {
+                ++m_arc[m_path.back()];
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Push one review along the current path.
+     *
+     * The path alternates article -> reviewer edges, which assign the pair, and
+     * reviewer -> article edges, which hand the article over to the previous reviewer.
+     */
+    void apply()
+    {
+        for (size_t step = 0; step + 2 < m_path.size(); ++step)
+        {
+            const auto from = m_path[step];
+            const auto to = m_path[step + 1];
+            if (from < m_articles)
+            {
+                const auto reviewer = to - m_articles;
+                const auto index = cell(reviewer, from);
+                m_assignedBits[index / 64] |= std::uint64_t{1} << (index % 64);
+                m_assigned[reviewer].push_back(from);
+            }
+            else
+            {
+                const auto reviewer = from - m_articles;
+                const auto index = cell(reviewer, to);
+                m_assignedBits[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+                auto& assignedArticles = m_assigned[reviewer];
+                assignedArticles[m_arc[from] - 1] = assignedArticles.back();
+                assignedArticles.pop_back();
+            }
+        }
+        ++m_taken[m_path.front()];
+    }
+
+    const BidMatrix& m_bids;                                      /**< The bids of every reviewer on every article. */
+    const ConflictMask& m_conflicts;                              /**< The pairs that must not be assigned. */
+    std::uint32_t m_articles;                                     /**< The number of articles. */
+    std::uint32_t m_reviewers;                                    /**< The number of reviewers. */
+    std::uint32_t m_sink;                                         /**< The index of the sink node. */
+    std::uint32_t m_quota;                                        /**< The number of reviews per article. */
+    std::uint32_t m_capacity{0};                                  /**< The maximum number of articles per reviewer. */
+    std::pmr::vector<std::uint64_t> m_assignedBits;               /**< One bit per assigned pair, article-major. */
+    std::pmr::vector<std::pmr::vector<std::uint32_t>> m_assigned; /**< The articles assigned to each reviewer. */
+    std::pmr::vector<std::uint32_t> m_taken;                      /**< The reviews assigned to each article. */
+    std::pmr::vector<std::int64_t> m_potential;                   /**< The node potentials. */
+    std::pmr::vector<std::int64_t> m_distance;                    /**< The reduced distances of the last Dijkstra. */
+    std::pmr::vector<std::int32_t> m_level;                       /**< The level of each node, or NO_LEVEL. */
+    std::pmr::vector<size_t> m_arc;                               /**< The current arc of each node. */
+    std::pmr::vector<std::uint32_t> m_queue;                      /**< The BFS queue. */
+    std::pmr::vector<std::uint32_t> m_path;                       /**< The path being explored. */
+    std::pmr::vector<HeapEntry> m_heap;                           /**< The min-heap of the Dijkstra search. */
+};
+} // namespace
+
+AssignmentStrategyOptimal::AssignmentStrategyOptimal(std::uint32_t reviewsPerArticle, std::uint32_t reviewerCapacity)
+    : m_reviewsPerArticle{reviewsPerArticle}, m_reviewerCapacity{reviewerCapacity}
+{
+}
+
+std::uint32_t AssignmentStrategyOptimal::reviewsPerArticle() const
+{
+    return m_reviewsPerArticle;
+}
+
+void AssignmentStrategyOptimal::assign(std::pmr::vector<ReviewAssignment>& assignments, const BidMatrix& bids,
+                                       const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed)
+{
+    assignments.clear();
+    const auto quota = std::min<size_t>(m_reviewsPerArticle, bids.reviewers());
+    if (bids.empty() || quota == 0)
+    {
+        return;
+    }
+
+    AssignmentNetwork network(bids, conflicts, reviewed, static_cast<std::uint32_t>(quota),
+                              assignments.get_allocator().resource());
+    const auto missing = network.missing();
+    if (missing == 0)
+    {
+        return;
+    }
+
+    // Spread the missing reviews evenly unless an explicit capacity was requested
+    const auto evenLoad = (missing + bids.reviewers() - 1) / bids.reviewers();
+    network.capacity(static_cast<std::uint32_t>(m_reviewerCapacity != 0 ? m_reviewerCapacity : evenLoad));
+    while (network.updatePotentials())
+    {
+        while (network.buildLevels())
+        {
+            network.blockingFlow();
+        }
+    }
+
+    assignments.reserve(missing);
+    network.collect(assignments);
+}
+
+std::uint32_t AssignmentStrategyOptimal::affinity(BiddingInterest interest)
+{
+    return AFFINITY[static_cast<size_t>(interest)];
+}
@@ -0,0 +1,89 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "assignmentStrategyRoundRobin.hpp"
+#include <algorithm>
+#include <numeric>
+
+AssignmentStrategyRoundRobin::AssignmentStrategyRoundRobin(std::uint32_t reviewsPerArticle)
+    : m_reviewsPerArticle{reviewsPerArticle}
+{
+}
+
+std::uint32_t AssignmentStrategyRoundRobin::reviewsPerArticle() const
+{
+    return m_reviewsPerArticle;
+}
+
+void AssignmentStrategyRoundRobin::assign(std::pmr::vector<ReviewAssignment>& assignments, const BidMatrix& bids,
+                                          const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed)
+{
+    assignments.clear();
+    if (bids.empty())
+    {
+        return;
+    }
+
+    // Count the reviews the articles hold, and sort the pairs already reviewed so they can be searched
+    const auto scratch = assignments.get_allocator().resource();
+    const auto reviewers = static_cast<std::uint32_t>(bids.reviewers());
+    std::pmr::vector<std::uint32_t> held(bids.articles(), 0, scratch);
+    std::pmr::vector<ReviewAssignment> done(scratch);
+    for (const auto& review : reviewed)
+    {
+        ++held[review.article];
+        if (review.reviewer < reviewers)
+        {
+            done.push_back(review);
+        }
+    }
+    const auto byPair = [](const ReviewAssignment& a, const ReviewAssignment& b) {
+        return a.article != b.article ? a.article < b.article : a.reviewer < b.reviewer;
+    };
+    std::sort(done.begin(), done.end(), byPair);
+
+    // Rank articles by the total interest placed on them by every reviewer
+    std::pmr::vector<size_t> demand(bids.articles(), 0, scratch);
+    for (size_t article = 0; article < bids.articles(); ++article)
+    {
+        for (const auto interest : bids.articleBids(article))
+        {
+            demand[article] += static_cast<size_t>(interest);
+        }
+    }
+
+    std::pmr::vector<std::uint32_t> order(bids.articles(), scratch);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::uint32_t a, std::uint32_t b) { return demand[a] > demand[b]; });
+
+    // Deal the articles to the reviewers in turns, until each holds its quota
+    const auto reviews = std::min(m_reviewsPerArticle, reviewers);
+    assignments.reserve(order.size() * reviews);
+
+    // A reviewer in conflict with an article, or who already reviewed it, loses its turn; each reviewer is offered
+    // an article at most once
+    std::uint32_t currentReviewer = 0;
+    for (const auto article : order)
+    {
+        std::uint32_t assigned = std::min(held[article], reviews);
+        for (std::uint32_t turn = 0; turn < reviewers && assigned < reviews; ++turn)
+        {
+            if (!conflicts.conflicted(currentReviewer, article) &&
+                !std::binary_search(done.begin(), done.end(), ReviewAssignment{currentReviewer, article}, byPair))
+            {
+                assignments.push_back({currentReviewer, article});
+                ++assigned;
+            }
+            if (++currentReviewer >= reviewers)
+            {
+                currentReviewer = 0;
+            }
+        }
+    }
+}
@@ -7,7 +7,6 @@
  */
 
 #include "bid.hpp"
-#include <iostream>
 
 Bid::Bid(const std::string& reviewerName, BiddingInterest bidType) : m_bidType(bidType), m_reviewerName(reviewerName)
 {
@@ -28,8 +27,8 @@ void Bid::biddingInterest(BiddingInterest interest)
 
 // LCOV_EXCL_STOP
 
-void Bid::bidSummary() const
+void Bid::bidSummary(ReportSink& sink) const
 {
-    std::cout << "Reviewer: " << m_reviewerName << std::endl;
-    std::cout << "Interest: " << static_cast<int>(m_bidType) << std::endl;
+    sink.report("bid", "Reviewer: {}\nInterest: {}",
+                {{"reviewer", m_reviewerName}, {"interest", static_cast<std::int64_t>(m_bidType)}});
 }
@@ -0,0 +1,60 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "bidMatrix.hpp"
+
+BidMatrix::BidMatrix(std::pmr::memory_resource* resource) : m_cells(resource)
+{
+}
+
+void BidMatrix::reset(size_t reviewers, size_t articles)
+{
+    m_reviewers = reviewers;
+    m_articles = articles;
+    m_cells.assign(reviewers * articles, BiddingInterest::None);
+}
+
+BiddingInterest BidMatrix::at(size_t reviewer, size_t article) const
+{
+    return m_cells[article * m_reviewers + reviewer];
+}
+
+void BidMatrix::set(size_t reviewer, size_t article, BiddingInterest interest)
+{
+    m_cells[article * m_reviewers + reviewer] = interest;
+}
+
+std::span<const BiddingInterest> BidMatrix::articleBids(size_t article) const
+{
+    return {m_cells.data() + article * m_reviewers, m_reviewers};
+}
+
+size_t BidMatrix::reviewers() const
+{
+    return m_reviewers;
+}
+
+size_t BidMatrix::articles() const
+{
+    return m_articles;
+}
+
+size_t BidMatrix::size() const
+{
+    return m_cells.size();
+}
+
+bool BidMatrix::empty() const
+{
+    return m_cells.empty();
+}
+
+std::pmr::memory_resource* BidMatrix::resource() const
+{
+    return m_cells.get_allocator().resource();
+}
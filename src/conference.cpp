@@ -13,7 +13,6 @@
 #include <chrono>
 #include <ctime>
 #include <iomanip>
-#include <iostream>
 #include <sstream>
 
 Conference::Conference(const nlohmann::json& conferenceJson)
@@ -26,19 +25,15 @@ Conference::Conference(const nlohmann::json& conferenceJson)
     {
         for (const auto& userJson : conferenceJson["users"])
         {
-            if (!userJson.at("isReviewer").get<bool>())
-            {
-                m_users.emplace_back(std::make_shared<User>(userJson));
-            }
-            else
-            {
-                auto reviewer = std::make_shared<Reviewer>(userJson);
-                m_reviewers.insert({reviewer->fullNames(), reviewer});
-                m_users.push_back(reviewer);
-            }
+            addUser(userJson);
         }
     }
 
+    if (conferenceJson.contains("seed"))
+    {
+        seed(conferenceJson.at("seed").get<std::uint64_t>());
+    }
+
     // Parse the conference's tracks
     // And add the reviewers to the tracks
     if (conferenceJson.contains("tracks"))
@@ -47,16 +42,51 @@ Conference::Conference(const nlohmann::json& conferenceJson)
         {
             try
             {
-                auto track = TrackFactory::createTrack(trackJson);
-                validateAndAddReviewers(track, trackJson);
-                m_tracks.push_back(track);
+                addTrack(trackJson);
             }
             catch (const std::exception& e)
             {
-                std::cout << "Error creating track: " << e.what() << std::endl;
+                m_reportSink->report("trackError", "Error creating track: {}", {{"message", e.what()}});
             }
         }
     }
+    createdAt(conferenceJson);
+}
+
+void Conference::addUser(const nlohmann::json& userJson)
+{
+    if (!userJson.at("isReviewer").get<bool>())
+    {
+        m_users.emplace_back(std::make_shared<User>(userJson));
+    }
+    else
+    {
+        auto reviewer = std::make_shared<Reviewer>(userJson);
+        reviewer->seed(m_seed);
+        m_reviewers.insert({reviewer->fullNames(), reviewer});
+        m_users.push_back(reviewer);
+    }
+    if (!m_conflicts->addUser(*m_users.back()))
+    {
+        m_reportSink->report("duplicateUser",
+                             "User '{}' is already registered with an affiliation other than '{}', conflicts of "
+                             "interest keep the first one",
+                             {{"name", m_users.back()->fullNames()}, {"affiliation", m_users.back()->affiliation()}});
+    }
+}
+
+std::shared_ptr<Track> Conference::addTrack(const nlohmann::json& trackJson)
+{
+    auto track = TrackFactory::createTrack(trackJson);
+    track->reportSink(m_reportSink);
+    track->conflictIndex(m_conflicts);
+    validateAndAddReviewers(track, trackJson);
+    m_tracks.push_back(track);
+    return track;
+}
+
+void Conference::createdAt(const nlohmann::json& conferenceJson)
+{
     if (conferenceJson.contains("createdAt"))
     {
         m_createdAt = parseDate(conferenceJson.value("createdAt", ""));
@@ -118,7 +148,39 @@ void Conference::selectionStart(const std::chrono::system_clock::time_point& tim
     m_selectionStart = timePoint;
 }
 
-std::vector<std::shared_ptr<Track>> Conference::tracks()
+std::uint64_t Conference::seed() const
+{
+    return m_seed;
+}
+
+void Conference::seed(std::uint64_t seed)
+{
+    m_seed = seed;
+    for (const auto& [name, reviewer] : m_reviewers)
+    {
+        reviewer->seed(seed);
+    }
+}
+
+void Conference::reportSink(const std::shared_ptr<ReportSink>& sink)
+{
+    m_reportSink = sink;
+    for (const auto& track : m_tracks)
+    {
+        track->reportSink(sink);
+    }
+}
+
+void Conference::mutationLog(const std::shared_ptr<MutationLog>& log)
+{
+    for (size_t track = 0; track < m_tracks.size(); ++track)
+    {
+        const auto position = static_cast<std::uint32_t>(track);
+        m_tracks[track]->journal(log != nullptr ? TrackJournal(log, position) : TrackJournal());
+    }
+}
+
+const std::vector<std::shared_ptr<Track>>& Conference::tracks() const
 {
     return m_tracks;
 }
@@ -152,8 +214,7 @@ size_t Conference::sizeParticipants()
 
 void Conference::printBiddingSummary()
 {
-    std::cout << "Bidding Summary" << std::endl;
-    std::cout << "================" << std::endl;
+    m_reportSink->report("summary", "Bidding Summary\n================", {{"phase", "bidding"}});
     for (const auto& track : m_tracks)
     {
         track->currentBids();
@@ -162,8 +223,7 @@ void Conference::printBiddingSummary()
 
 void Conference::printReviewSummary()
 {
-    std::cout << "Review Summary" << std::endl;
-    std::cout << "================" << std::endl;
+    m_reportSink->report("summary", "Review Summary\n================", {{"phase", "review"}});
     for (const auto& track : m_tracks)
     {
         track->currentReviews();
@@ -0,0 +1,219 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conferenceGenerator.hpp"
+#include "articleRegular.hpp"
+#include "assignmentStrategyRoundRobin.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr std::uint32_t REVIEWER_DOMAIN = 1; /**< The streams drawing the affiliations of the reviewers. */
+constexpr std::uint32_t AUTHOR_DOMAIN = 2;   /**< The streams drawing the affiliations of the authors. */
+constexpr std::uint32_t ARTICLE_DOMAIN = 3;  /**< The streams drawing the authors of the articles. */
+constexpr std::uint32_t BID_DOMAIN = 4;      /**< The streams drawing the bid rates of the reviewers. */
+constexpr double DRAWS = 4294967296.0;       /**< The number of distinct 32-bit draws. */
+
+/** The cumulative weights of the number of authors of an article, from one to six. */
+const std::vector<double> AUTHOR_COUNTS{0.10, 0.35, 0.65, 0.85, 0.95, 1.0};
+
+/**
+ * @brief Compute the cumulative weights of a Zipf law.
+ * @param values The number of values.
+ * @param exponent The exponent of the law, 0 for a uniform law.
+ * @return The cumulative weight of each value, the k-th value weighing 1 / k^exponent.
+ */
+std::vector<double> zipf(std::size_t values, double exponent)
+{
+    std::vector<double> cumulative(values);
+    double total = 0.0;
+    for (std::size_t value = 0; value < values; ++value)
+    {
+        total += 1.0 / std::pow(static_cast<double>(value + 1), exponent);
+        cumulative[value] = total;
+    }
+    return cumulative;
+}
+} // namespace
+
+ConferenceShape ConferenceShape::production()
+{
+    return {.tracks = 100,
+            .articles = 2'000,
+            .reviewers = 10'000,
+            .reviewersPerTrack = 300,
+            .reviewsPerArticle = 3,
+            .authors = 120'000,
+            .affiliations = 1'500,
+            .bidSkew = 3.0};
+}
+
+ConferenceGenerator::ConferenceGenerator(const ConferenceShape& shape)
+    : m_shape(shape), m_affiliations(zipf(std::max<std::size_t>(shape.affiliations, 1), shape.affiliationSkew)),
+      m_authors(zipf(shape.authors, shape.authorSkew))
+{
+}
+
+const ConferenceShape& ConferenceGenerator::shape() const
+{
+    return m_shape;
+}
+
+nlohmann::json ConferenceGenerator::describe() const
+{
+    nlohmann::json conferenceJson = {{"createdAt", "2024-07-18T00:00:00Z"},
+                                     {"seed", m_shape.seed},
+                                     {"users", nlohmann::json::array()},
+                                     {"tracks", nlohmann::json::array()}};
+
+    auto& users = conferenceJson["users"];
+    for (std::size_t reviewer = 0; reviewer < m_shape.reviewers; ++reviewer)
+    {
+        users.push_back(describeUser(reviewerName(reviewer), REVIEWER_DOMAIN, reviewer));
+    }
+    for (std::size_t author = 0; author < m_shape.authors; ++author)
+    {
+        users.push_back(describeUser(authorName(author), AUTHOR_DOMAIN, author));
+    }
+
+    for (std::size_t track = 0; track < m_shape.tracks; ++track)
+    {
+        conferenceJson["tracks"].push_back(describeTrack(track));
+    }
+    return conferenceJson;
+}
+
+void ConferenceGenerator::write(std::ostream& output) const
+{
+    auto conferenceJson = describe();
+    output << R"({"createdAt":)" << conferenceJson["createdAt"] << R"(,"seed":)" << conferenceJson["seed"]
+           << R"(,"users":)" << conferenceJson["users"] << R"(,"tracks":[)";
+    conferenceJson.clear();
+
+    for (std::size_t track = 0; track < m_shape.tracks; ++track)
+    {
+        const auto trackJson = describeTrack(track);
+        output << (track == 0 ? "" : ",") << R"({"trackType":)" << trackJson["trackType"] << R"(,"trackTopic":)"
+               << trackJson["trackTopic"] << R"(,"reviewers":)" << trackJson["reviewers"] << R"(,"articles":[)";
+        const auto trackArticles = articles(track);
+        for (std::size_t article = 0; article < trackArticles.size(); ++article)
+        {
+            const auto& regular = static_cast<const ArticleRegular&>(*trackArticles[article]);
+            output << (article == 0 ? "" : ",")
+                   << nlohmann::json{{"articleType", "regular"},
+                                     {"articleTitle", regular.articleName()},
+                                     {"attachedFileUrl", regular.attachedUrl()},
+                                     {"authors", regular.authors()},
+                                     {"abstract", regular.abstract()}};
+        }
+        output << "]}";
+    }
+    output << "]}";
+}
+
+std::shared_ptr<Conference> ConferenceGenerator::conference() const
+{
+    auto conference = std::make_shared<Conference>(describe());
+    const auto strategy = std::make_shared<AssignmentStrategyRoundRobin>(m_shape.reviewsPerArticle);
+    for (const auto& track : conference->tracks())
+    {
+        track->assignmentStrategy(strategy);
+    }
+    return conference;
+}
+
+std::vector<std::shared_ptr<Article>> ConferenceGenerator::articles(std::size_t track) const
+{
+    std::vector<std::shared_ptr<Article>> articles;
+    articles.reserve(m_shape.articles);
+    const auto key = RandomStream::mix(m_shape.seed, track);
+    for (std::size_t article = 0; article < m_shape.articles; ++article)
+    {
+        RandomStream stream(key, article, ARTICLE_DOMAIN);
+        std::vector<std::string> authors;
+        if (!m_authors.empty())
+        {
+            // Prolific authors may be drawn twice, the article then has one author less
+            const auto count = draw(AUTHOR_COUNTS, stream) + 1;
+            for (std::size_t slot = 0; slot < count; ++slot)
+            {
+                auto author = authorName(draw(m_authors, stream));
+                if (std::find(authors.begin(), authors.end(), author) == authors.end())
+                {
+                    authors.push_back(std::move(author));
+                }
+            }
+        }
+        const auto id = std::to_string(track) + "." + std::to_string(article);
+        articles.push_back(std::make_shared<ArticleRegular>("Article " + id, "https://bit.ly/" + id,
+                                                            std::move(authors), "Synthetic article " + id));
+    }
+    return articles;
+}
+
+void ConferenceGenerator::submit(Conference& conference) const
+{
+    for (std::size_t track = 0; track < conference.tracks().size(); ++track)
+    {
+        conference.tracks()[track]->handleTrackArticles(articles(track), OperationType::Create);
+    }
+}
+
+nlohmann::json ConferenceGenerator::describeTrack(std::size_t track) const
+{
+    // Each track takes a window of reviewers starting at its share of the pool, so windows overlap when they are
+    // wider than the share
+    const auto window = m_shape.reviewersPerTrack == 0 ? m_shape.reviewers
+                                                       : std::min(m_shape.reviewersPerTrack, m_shape.reviewers);
+    const auto first = track * m_shape.reviewers / m_shape.tracks;
+    auto reviewers = nlohmann::json::array();
+    for (std::size_t reviewer = 0; reviewer < window; ++reviewer)
+    {
+        reviewers.push_back(reviewerName((first + reviewer) % m_shape.reviewers));
+    }
+    return {{"trackType", "regular"}, {"trackTopic", "Track " + std::to_string(track)}, {"reviewers", reviewers}};
+}
+
+std::size_t ConferenceGenerator::draw(const std::vector<double>& cumulative, RandomStream& stream)
+{
+    const auto target = (stream.next() + 0.5) / DRAWS * cumulative.back();
+    const auto value = std::upper_bound(cumulative.begin(), cumulative.end(), target) - cumulative.begin();
+    return std::min(static_cast<std::size_t>(value), cumulative.size() - 1);
+}
+
+std::string ConferenceGenerator::reviewerName(std::size_t reviewer)
+{
+    return "Reviewer " + std::to_string(reviewer);
+}
+
+std::string ConferenceGenerator::authorName(std::size_t author)
+{
+    return "Author " + std::to_string(author);
+}
+
+nlohmann::json ConferenceGenerator::describeUser(const std::string& name, std::uint32_t domain,
+                                                 std::size_t user) const
+{
+    RandomStream stream(m_shape.seed, user, domain);
+    const auto affiliation = draw(m_affiliations, stream);
+    nlohmann::json userJson = {{"name", name},
+                               {"affiliation", "Affiliation " + std::to_string(affiliation)},
+                               {"email", (domain == REVIEWER_DOMAIN ? "reviewer" : "author") + std::to_string(user) +
+                                             "@comfychair.org"},
+                               {"password", "1234"},
+                               {"isChair", false},
+                               {"isAuthor", domain == AUTHOR_DOMAIN},
+                               {"isReviewer", domain == REVIEWER_DOMAIN}};
+    if (domain == REVIEWER_DOMAIN && m_shape.bidSkew > 0.0)
+    {
+        RandomStream bids(m_shape.seed, user, BID_DOMAIN);
+        userJson["bidRate"] = std::pow(bids.next() / DRAWS, m_shape.bidSkew);
+    }
+    return userJson;
+}
@@ -0,0 +1,344 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conferenceLoader.hpp"
+#include "articleFactory.hpp"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+ConferenceLoader::ConferenceLoader(std::shared_ptr<Conference> conference)
+    : m_conference(std::move(conference)), m_settings(nlohmann::json::object())
+{
+}
+
+std::shared_ptr<Conference> ConferenceLoader::load(std::istream& input)
+{
+    ConferenceLoader loader(std::make_shared<Conference>());
+    nlohmann::json::sax_parse(input, &loader);
+    return loader.m_conference;
+}
+
+std::shared_ptr<Conference> ConferenceLoader::load(const std::string& path)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+        throw std::invalid_argument("Cannot open conference file: " + path);
+    }
+    return load(input);
+}
+
+bool ConferenceLoader::null()
+{
+    return scalar(nullptr);
+}
+
+bool ConferenceLoader::boolean(bool value)
+{
+    return scalar(value);
+}
+
+bool ConferenceLoader::number_integer(number_integer_t value)
+{
+    return scalar(value);
+}
+
+bool ConferenceLoader::number_unsigned(number_unsigned_t value)
+{
+    return scalar(value);
+}
+
+bool ConferenceLoader::number_float(number_float_t value, const string_t& /*text*/)
+{
+    return scalar(value);
+}
+
+bool ConferenceLoader::string(string_t& value)
+{
+    return scalar(std::move(value));
+}
+
+bool ConferenceLoader::binary(binary_t& value)
+{
+    return scalar(nlohmann::json::binary(std::move(value)));
+}
+
+bool ConferenceLoader::start_object(std::size_t /*elements*/)
+{
+    return open(nlohmann::json::object());
+}
+
+bool ConferenceLoader::key(string_t& value)
+{
+    if (!m_elementStack.empty())
+    {
+        m_elementKey = std::move(value);
+    }
+    else if (m_level == Level::Root)
+    {
+        m_rootKey = std::move(value);
+    }
+    else if (m_level == Level::Track)
+    {
+        m_trackKey = std::move(value);
+    }
+    return true;
+}
+
+bool ConferenceLoader::end_object()
+{
+    return close();
+}
+
+bool ConferenceLoader::start_array(std::size_t /*elements*/)
+{
+    return open(nlohmann::json::array());
+}
+
+bool ConferenceLoader::end_array()
+{
+    return close();
+}
+
+bool ConferenceLoader::parse_error(std::size_t /*position*/, const std::string& /*lastToken*/,
+                                   const nlohmann::detail::exception& error)
+{
+    throw std::invalid_argument("Invalid conference data: " + std::string(error.what()));
+}
+
+bool ConferenceLoader::scalar(nlohmann::json&& value)
+{
+    if (m_elementStack.empty() && m_level == Level::Document)
+    {
+        throw std::invalid_argument("Invalid conference data: the document must be an object");
+    }
+
+    place(std::move(value));
+    if (m_elementStack.empty())
+    {
+        complete();
+    }
+    return true;
+}
+
+bool ConferenceLoader::open(nlohmann::json&& value)
+{
+    if (!m_elementStack.empty() || !enter(value.is_object()))
+    {
+        m_elementStack.push_back(place(std::move(value)));
+    }
+    return true;
+}
+
+bool ConferenceLoader::close()
+{
+    if (!m_elementStack.empty())
+    {
+        m_elementStack.pop_back();
+        if (m_elementStack.empty())
+        {
+            complete();
+        }
+        return true;
+    }
+
+    switch (m_level)
+    {
+    case Level::Articles:
+        m_level = Level::Track;
+        break;
+    case Level::Track:
+        endTrack();
+        m_level = Level::List;
+        break;
+    case Level::List:
+        m_level = Level::Root;
+        break;
+    case Level::Root:
+        m_conference->createdAt(m_settings);
+        m_level = Level::Document;
+        break;
+    case Level::Document:
+        break;
+    }
+    return true;
+}
+
+bool ConferenceLoader::enter(bool isObject)
+{
+    switch (m_level)
+    {
+    case Level::Document:
+        if (!isObject)
+        {
+            throw std::invalid_argument("Invalid conference data: the document must be an object");
+        }
+        m_level = Level::Root;
+        return true;
+    case Level::Root:
+        if (!isObject && (m_rootKey == "users" || m_rootKey == "tracks"))
+        {
+            m_level = Level::List;
+            return true;
+        }
+        return false;
+    case Level::List:
+        if (isObject && m_rootKey == "tracks")
+        {
+            m_trackJson = nlohmann::json::object();
+            m_track = nullptr;
+            m_trackFailed = false;
+            m_level = Level::Track;
+            return true;
+        }
+        return false;
+    case Level::Track:
+        if (!isObject && m_trackKey == "articles")
+        {
+            m_level = Level::Articles;
+            return true;
+        }
+        return false;
+    case Level::Articles:
+        return false;
+    }
+    return false;
+}
+
+nlohmann::json* ConferenceLoader::place(nlohmann::json&& value)
+{
+    if (m_elementStack.empty())
+    {
+        m_element = std::move(value);
+        return &m_element;
+    }
+
+    auto& parent = *m_elementStack.back();
+    if (parent.is_array())
+    {
+        parent.push_back(std::move(value));
+        return &parent.back();
+    }
+    return &(parent[m_elementKey] = std::move(value));
+}
+
+void ConferenceLoader::complete()
+{
+    switch (m_level)
+    {
+    case Level::Root:
+        if (m_rootKey == "seed")
+        {
+            m_conference->seed(m_element.get<std::uint64_t>());
+        }
+        else if (m_rootKey != "users" && m_rootKey != "tracks")
+        {
+            m_settings[m_rootKey] = std::move(m_element);
+        }
+        break;
+    case Level::List:
+        if (m_rootKey == "users")
+        {
+            m_conference->addUser(m_element);
+        }
+        else
+        {
+            // A track that is not an object, reported the way the factory reports it
+            m_trackJson = std::move(m_element);
+            m_track = nullptr;
+            m_trackFailed = false;
+            endTrack();
+        }
+        break;
+    case Level::Track:
+        if (m_trackKey == "reviewers" && m_track != nullptr)
+        {
+            // The reviewers come after the articles that created the track
+            try
+            {
+                m_conference->validateAndAddReviewers(m_track, nlohmann::json{{"reviewers", m_element}});
+            }
+            catch (const std::exception& e)
+            {
+                m_conference->m_reportSink->report("trackError", "Error creating track: {}", {{"message", e.what()}});
+                m_conference->m_tracks.pop_back();
+                m_track = nullptr;
+                m_trackFailed = true;
+            }
+        }
+        m_trackJson[m_trackKey] = std::move(m_element);
+        break;
+    case Level::Articles:
+        addArticle(m_element);
+        break;
+    case Level::Document:
+        break;
+    }
+    m_element = nullptr;
+}
+
+void ConferenceLoader::createTrack()
+{
+    try
+    {
+        m_track = m_conference->addTrack(m_trackJson);
+    }
+    catch (const std::exception& e)
+    {
+        m_conference->m_reportSink->report("trackError", "Error creating track: {}", {{"message", e.what()}});
+        m_trackFailed = true;
+    }
+}
+
+void ConferenceLoader::addArticle(const nlohmann::json& articleJson)
+{
+    if (m_trackFailed)
+    {
+        return;
+    }
+    if (m_track == nullptr)
+    {
+        // The track cannot be created before its type is known
+        if (!m_trackJson.is_object() || !m_trackJson.contains("trackType"))
+        {
+            m_pendingArticles.push_back(articleJson);
+            return;
+        }
+        createTrack();
+        if (m_track == nullptr)
+        {
+            return;
+        }
+    }
+
+    try
+    {
+        m_track->handleTrackArticle(ArticleFactory::createArticle(articleJson), OperationType::Create);
+    }
+    catch (const std::exception& e)
+    {
+        m_conference->m_reportSink->report("articleError", "Error creating article: {}", {{"message", e.what()}});
+    }
+}
+
+void ConferenceLoader::endTrack()
+{
+    if (m_track == nullptr && !m_trackFailed)
+    {
+        createTrack();
+    }
+
+    auto pending = std::move(m_pendingArticles);
+    m_pendingArticles.clear();
+    for (const auto& articleJson : pending)
+    {
+        addArticle(articleJson);
+    }
+    m_track = nullptr;
+}
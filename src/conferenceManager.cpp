@@ -7,38 +7,137 @@
  */
 
 #include "conferenceManager.hpp"
+#include "reviewer.hpp"
 #include "trackStateBidding.hpp"
-#include "trackStateReception.hpp"
 #include "trackStateReview.hpp"
 #include "trackStateSelection.hpp"
+#include <exception>
+#include <vector>
 
 void ConferenceManager::startBidding(std::chrono::system_clock::time_point time)
 {
+    ScopedTimer timer(phaseTimer("comfychair_phase_transition_seconds", "bidding"));
     for (auto& track : m_conference->tracks())
     {
-        track->establishState(std::make_shared<BiddingStateTrack>());
+        track->establishState(BiddingStateTrack{});
         m_conference->biddingStart(time);
     }
 }
 
 void ConferenceManager::startRevision(std::chrono::system_clock::time_point time)
 {
+    ScopedTimer timer(phaseTimer("comfychair_phase_transition_seconds", "review"));
     for (auto& track : m_conference->tracks())
     {
-        track->establishState(std::make_shared<ReviewStateTrack>());
+        track->establishState(ReviewStateTrack{});
         m_conference->revisionStart(time);
     }
 }
 
 void ConferenceManager::startSelection(std::chrono::system_clock::time_point time)
 {
+    ScopedTimer timer(phaseTimer("comfychair_phase_transition_seconds", "selection"));
     for (auto& track : m_conference->tracks())
     {
-        track->establishState(std::make_shared<SelectionStateTrack>());
+        track->establishState(SelectionStateTrack{});
         m_conference->selectionStart(time);
     }
 }
 
+void ConferenceManager::runBidding()
+{
+    runPhase("bidding", [](Track& track) {
+        if (track.handleTrackBidding())
+        {
+            if constexpr (METRICS_ENABLED)
+            {
+                Metrics::global()
+                    .counter("comfychair_bids_total", {{"track", track.trackName()}})
+                    .add(track.bidMatrix().size());
+            }
+        }
+    });
+}
+
+void ConferenceManager::runReview()
+{
+    runPhase("review", [](Track& track) {
+        const auto reviews = METRICS_ENABLED ? track.reviewStore().size() : 0;
+        if (track.handleTrackReview())
+        {
+            if constexpr (METRICS_ENABLED)
+            {
+                Metrics::global()
+                    .counter("comfychair_reviews_total", {{"track", track.trackName()}})
+                    .add(track.reviewStore().size() - reviews);
+            }
+        }
+    });
+}
+
+void ConferenceManager::runPhase(std::string_view name, const std::function<void(Track&)>& phase)
+{
+    ScopedTimer timer(phaseTimer("comfychair_phase_seconds", name));
+    const auto heap = METRICS_ENABLED ? Metrics::heapInUse() : 0;
+
+    const auto& tracks = m_conference->tracks();
+    std::vector<ReviewerBuffer> buffers(tracks.size());
+    std::exception_ptr error;
+    try
+    {
+        m_executor.run(tracks.size(), [&](size_t track) {
+            ReviewerBuffer::Scope scope(buffers[track]);
+            ScopedTimer trackTimer(phaseTimer("comfychair_track_phase_seconds", name, tracks[track].get()));
+            phase(*tracks[track]);
+            if constexpr (METRICS_ENABLED)
+            {
+                Metrics::global()
+                    .counter("comfychair_articles_processed_total",
+                             {{"track", tracks[track]->trackName()}, {"phase", std::string(name)}})
+                    .add(tracks[track]->amountArticles());
+            }
+        });
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // Hand the buffered bids and reviews to the reviewers, keeping what a failing phase placed
+    for (auto& buffer : buffers)
+    {
+        buffer.merge();
+    }
+    if constexpr (METRICS_ENABLED)
+    {
+        Metrics::global()
+            .gauge("comfychair_phase_heap_growth_bytes", {{"phase", std::string(name)}})
+            .set(static_cast<double>(Metrics::heapInUse()) - static_cast<double>(heap));
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+Histogram* ConferenceManager::phaseTimer(std::string_view metric, std::string_view phase, const Track* track)
+{
+    if constexpr (!METRICS_ENABLED)
+    {
+        return nullptr;
+    }
+    else
+    {
+        MetricLabels labels;
+        if (track != nullptr)
+        {
+            labels.emplace_back("track", track->trackName());
+        }
+        labels.emplace_back("phase", phase);
+        return &Metrics::global().histogram(metric, labels);
+    }
+}
+
 std::shared_ptr<Conference> ConferenceManager::conference()
 {
     return m_conference;
@@ -0,0 +1,737 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conferenceSnapshot.hpp"
+#include "articlePoster.hpp"
+#include "articleRegular.hpp"
+#include "trackFactory.hpp"
+#include "trackPhase.hpp"
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr std::array<char, 8> MAGIC{'C', 'C', 'S', 'N', 'A', 'P', '\r', '\n'}; /**< Identifies snapshot files. */
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304; /**< Read back swapped on a machine of the other byte order. */
+constexpr std::uint64_t SECTION_ALIGNMENT = 8;        /**< Alignment of the start of every section. */
+
+/**
+ * @brief Sections of a snapshot, in file order.
+ */
+enum class Section : std::uint32_t
+{
+    StringOffsets,  /**< Offset of each string in the string data, plus the end offset. */
+    StringData,     /**< The bytes of every string, back to back. */
+    Users,          /**< One UserRecord per user. */
+    Tracks,         /**< One TrackRecord per track. */
+    Articles,       /**< One ArticleRecord per article, grouped by track. */
+    Authors,        /**< String ids of the authors, grouped by article. */
+    TrackReviewers, /**< User ids of the reviewers, grouped by track. */
+    Bids,           /**< One byte per bid, grouped by track, article-major. */
+    Reviews,        /**< One ReviewRecord per review, grouped by track and sorted by article. */
+    Count           /**< The number of sections. */
+};
+
+constexpr size_t SECTION_COUNT = static_cast<size_t>(Section::Count); /**< The number of sections. */
+
+/**
+ * @brief Location of a section in the file.
+ */
+struct SectionEntry
+{
+    std::uint64_t offset; /**< The offset of the section from the start of the file. */
+    std::uint64_t count;  /**< The number of elements in the section. */
+};
+
+/**
+ * @brief Fixed header at the start of the file.
+ */
+struct SnapshotHeader
+{
+    std::array<char, 8> magic;                        /**< Always MAGIC. */
+    std::uint32_t version;                            /**< The version of the format. */
+    std::uint32_t byteOrder;                          /**< Always BYTE_ORDER_MARK. */
+    std::uint64_t seed;                               /**< The seed of the conference. */
+    std::int64_t createdAt;                           /**< The creation date, in nanoseconds since the epoch. */
+    std::uint64_t fileSize;                           /**< The size of the whole file. */
+    std::array<SectionEntry, SECTION_COUNT> sections; /**< The location of every section. */
+};
+
+/**
+ * @brief Flags of a user record.
+ */
+enum UserFlag : std::uint8_t
+{
+    Chair = 1,    /**< The user is a chair. */
+    Author = 2,   /**< The user is an author. */
+    Reviewing = 4 /**< The user is a reviewer. */
+};
+
+/**
+ * @brief Fixed-width record of a user.
+ */
+struct UserRecord
+{
+    std::uint32_t name;                 /**< String id of the full name. */
+    std::uint32_t affiliation;          /**< String id of the affiliation. */
+    std::uint32_t email;                /**< String id of the email. */
+    std::uint8_t flags;                 /**< Combination of UserFlag values. */
+    std::array<std::uint8_t, 3> unused; /**< Padding, always zero. */
+};
+
+/**
+ * @brief Fixed-width record of a track.
+ */
+struct TrackRecord
+{
+    std::uint32_t topic;         /**< String id of the topic. */
+    std::uint8_t type;           /**< 0 for regular, 1 for workshop, 2 for poster. */
+    std::uint8_t state;          /**< 0 for reception, 1 for bidding, 2 for review, 3 for selection. */
+    std::uint16_t unused;        /**< Padding, always zero. */
+    std::uint32_t firstArticle;  /**< Index of the first article record of the track. */
+    std::uint32_t articleCount;  /**< Number of articles of the track. */
+    std::uint32_t firstReviewer; /**< Index of the first reviewer of the track. */
+    std::uint32_t reviewerCount; /**< Number of reviewers of the track. */
+    std::uint32_t bidReviewers;  /**< Reviewers covered by the bids. */
+    std::uint32_t bidArticles;   /**< Articles covered by the bids. */
+    std::uint64_t firstBid;      /**< Index of the first bid of the track. */
+    std::uint32_t firstReview;   /**< Index of the first review record of the track. */
+    std::uint32_t reviewCount;   /**< Number of reviews of the track. */
+};
+
+/**
+ * @brief Fixed-width record of an article.
+ */
+struct ArticleRecord
+{
+    std::uint32_t title;                /**< String id of the title. */
+    std::uint32_t attachedUrl;          /**< String id of the attached file URL. */
+    std::uint32_t detail;               /**< String id of the abstract, or of the second attachment of a poster. */
+    std::uint8_t type;                  /**< 0 for a regular article, 1 for a poster. */
+    std::array<std::uint8_t, 3> unused; /**< Padding, always zero. */
+    std::uint32_t firstAuthor;          /**< Index of the first author of the article. */
+    std::uint32_t authorCount;          /**< Number of authors of the article. */
+};
+
+/**
+ * @brief Fixed-width record of a review.
+ */
+struct ReviewRecord
+{
+    std::uint32_t reviewer;  /**< Id of the reviewer in its track, or ReviewStore::NO_REVIEWER. */
+    std::uint32_t article;   /**< Id of the article in its track. */
+    std::uint32_t text;      /**< String id of the text. */
+    std::int8_t rating;      /**< The rating, from -3 to 3. */
+    std::uint8_t confidence; /**< The confidence, from 1 to 3. */
+    std::uint16_t unused;    /**< Padding, always zero. */
+};
+
+static_assert(sizeof(SnapshotHeader) == 40 + 16 * SECTION_COUNT);
+static_assert(sizeof(UserRecord) == 16 && sizeof(TrackRecord) == 48);
+static_assert(sizeof(ArticleRecord) == 24 && sizeof(ReviewRecord) == 16);
+
+constexpr std::array<const char*, 3> TRACK_TYPES{"regular", "workshop", "poster"}; /**< Track types by code. */
+
+/**
+ * @class StringTable
+ * @brief Deduplicating table of the strings of a snapshot being written.
+ */
+class StringTable
+{
+  public:
+    StringTable()
+    {
+        intern("");
+    }
+
+    /**
+     * @brief Get the id of a string, adding it to the table if needed.
+     * @param text The string.
+     * @return The id of the string.
+     */
+    std::uint32_t intern(const std::string& text)
+    {
+        const auto [position, inserted] = m_ids.try_emplace(text, static_cast<std::uint32_t>(m_offsets.size()));
+        if (inserted)
+        {
+            m_offsets.push_back(m_data.size());
+            m_data += text;
+        }
+        return position->second;
+    }
+
+    /**
+     * @brief Get the offsets of the strings, followed by the end offset.
+     * @return The offsets.
+     */
+    std::vector<std::uint64_t> offsets() const
+    {
+        auto offsets = m_offsets;
+        offsets.push_back(m_data.size());
+        return offsets;
+    }
+
+    /**
+     * @brief Get the bytes of every string.
+     * @return The string data.
+     */
+    const std::string& data() const
+    {
+        return m_data;
+    }
+
+  private:
+    std::unordered_map<std::string, std::uint32_t> m_ids; /**< The id of every string. */
+    std::vector<std::uint64_t> m_offsets;                 /**< The offset of every string. */
+    std::string m_data;                                   /**< The strings, back to back. */
+};
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ */
+class MappedFile
+{
+  public:
+    explicit MappedFile(const std::string& path)
+    {
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("Cannot open snapshot: " + path);
+        }
+        struct stat status
+        {
+        };
+        if (::fstat(descriptor, &status) != 0 || status.st_size <= 0)
+        {
+            ::close(descriptor);
+            throw std::runtime_error("Invalid snapshot: " + path + " is empty");
+        }
+        m_size = static_cast<size_t>(status.st_size);
+        m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (m_data == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot map snapshot: " + path);
+        }
+    }
+
+    ~MappedFile()
+    {
+        ::munmap(m_data, m_size);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Get the bytes of the file.
+     * @return The mapped bytes.
+     */
+    std::span<const std::byte> bytes() const
+    {
+        return {static_cast<const std::byte*>(m_data), m_size};
+    }
+
+  private:
+    void* m_data{nullptr}; /**< The start of the mapping. */
+    size_t m_size{0};      /**< The size of the mapping. */
+};
+
+/**
+ * @brief Flush a file or a directory to the storage device.
+ * @param path The path of the file or directory.
+ *
+ * Throws a runtime_error if it cannot be opened or flushed.
+ */
+void syncPath(const std::string& path)
+{
+    const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+    {
+        throw std::runtime_error("Cannot open for sync: " + path);
+    }
+    const bool synced = ::fsync(descriptor) == 0;
+    ::close(descriptor);
+    if (!synced)
+    {
+        throw std::runtime_error("Cannot sync snapshot: " + path);
+    }
+}
+
+/**
+ * @class SnapshotReader
+ * @brief Bounds-checked view over the sections of a mapped snapshot.
+ */
+class SnapshotReader
+{
+  public:
+    explicit SnapshotReader(std::span<const std::byte> bytes) : m_bytes(bytes)
+    {
+        if (bytes.size() < sizeof(SnapshotHeader))
+        {
+            fail("the file is too short");
+        }
+        std::memcpy(&m_header, bytes.data(), sizeof(SnapshotHeader));
+        if (m_header.magic != MAGIC)
+        {
+            fail("not a snapshot file");
+        }
+        if (m_header.byteOrder != BYTE_ORDER_MARK)
+        {
+            fail("written on a machine of another byte order");
+        }
+        if (m_header.version != ConferenceSnapshot::VERSION)
+        {
+            fail("unsupported version " + std::to_string(m_header.version));
+        }
+        if (m_header.fileSize != bytes.size())
+        {
+            fail("the file is truncated");
+        }
+
+        m_offsets = section<std::uint64_t>(Section::StringOffsets);
+        m_data = section<char>(Section::StringData);
+        if (m_offsets.empty() || m_offsets.back() != m_data.size())
+        {
+            fail("corrupted string table");
+        }
+        for (size_t string = 1; string < m_offsets.size(); ++string)
+        {
+            if (m_offsets[string] < m_offsets[string - 1])
+            {
+                fail("corrupted string table");
+            }
+        }
+    }
+
+    /**
+     * @brief Get the header of the snapshot.
+     * @return The header.
+     */
+    const SnapshotHeader& header() const
+    {
+        return m_header;
+    }
+
+    /**
+     * @brief Get the elements of a section.
+     * @param id The section.
+     * @return The elements, read in place from the mapping.
+     */
+    template <typename T> std::span<const T> section(Section id) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto& entry = m_header.sections[static_cast<size_t>(id)];
+        if (entry.offset % alignof(T) != 0 || entry.offset > m_bytes.size() ||
+            entry.count > (m_bytes.size() - entry.offset) / sizeof(T))
+        {
+            fail("section " + std::to_string(static_cast<std::uint32_t>(id)) + " is out of bounds");
+        }
+        return {reinterpret_cast<const T*>(m_bytes.data() + entry.offset), static_cast<size_t>(entry.count)};
+    }
+
+    /**
+     * @brief Get a string of the string table.
+     * @param id The id of the string.
+     * @return The string, viewed in place.
+     */
+    std::string_view string(std::uint32_t id) const
+    {
+        if (id + size_t{1} >= m_offsets.size())
+        {
+            fail("string id out of range");
+        }
+        return {m_data.data() + m_offsets[id], static_cast<size_t>(m_offsets[id + 1] - m_offsets[id])};
+    }
+
+    /**
+     * @brief Check that a range of records lies within a section.
+     * @param first The index of the first record.
+     * @param count The number of records.
+     * @param size The number of records in the section.
+     */
+    static void range(std::uint64_t first, std::uint64_t count, size_t size)
+    {
+        if (first > size || count > size - first)
+        {
+            fail("record range out of bounds");
+        }
+    }
+
+    /**
+     * @brief Report a corrupted snapshot.
+     * @param reason What is wrong with the snapshot.
+     */
+    [[noreturn]] static void fail(const std::string& reason)
+    {
+        throw std::runtime_error("Invalid snapshot: " + reason);
+    }
+
+  private:
+    std::span<const std::byte> m_bytes;       /**< The whole file. */
+    SnapshotHeader m_header{};                /**< A copy of the header. */
+    std::span<const std::uint64_t> m_offsets; /**< The offsets of the strings. */
+    std::span<const char> m_data;             /**< The bytes of the strings. */
+};
+
+/**
+ * @brief Get the code of the state of a track.
+ * @param state The state.
+ * @return The code saved in the track record.
+ */
+std::uint8_t stateCode(const TrackPhase& state)
+{
+    return static_cast<std::uint8_t>(state.index());
+}
+
+/**
+ * @brief Create the state saved with a code.
+ * @param code The code saved in the track record.
+ * @return The state.
+ */
+TrackPhase stateOf(std::uint8_t code)
+{
+    if (const auto phase = TrackPhase::at(code))
+    {
+        return *phase;
+    }
+    SnapshotReader::fail("unknown track state " + std::to_string(code));
+}
+
+/**
+ * @brief Append the elements of a section to the file.
+ * @param output The file.
+ * @param entry The entry of the section in the header, filled in.
+ * @param elements The elements.
+ */
+template <typename T>
+void writeSection(std::ofstream& output, SectionEntry& entry, std::span<const T> elements)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    static constexpr std::array<char, SECTION_ALIGNMENT> padding{};
+    const auto position = static_cast<std::uint64_t>(output.tellp());
+    output.write(padding.data(), static_cast<std::streamsize>((SECTION_ALIGNMENT - position % SECTION_ALIGNMENT) %
+                                                              SECTION_ALIGNMENT));
+    entry.offset = static_cast<std::uint64_t>(output.tellp());
+    entry.count = elements.size();
+    output.write(reinterpret_cast<const char*>(elements.data()), static_cast<std::streamsize>(elements.size_bytes()));
+}
+} // namespace
+
+void ConferenceSnapshot::write(const Conference& conference, const std::string& path)
+{
+    StringTable strings;
+    std::vector<UserRecord> users;
+    std::vector<TrackRecord> tracks;
+    std::vector<ArticleRecord> articles;
+    std::vector<std::uint32_t> authors;
+    std::vector<std::uint32_t> trackReviewers;
+    std::vector<BiddingInterest> bids;
+    std::vector<ReviewRecord> reviews;
+
+    std::unordered_map<const User*, std::uint32_t> userIds;
+    for (const auto& user : conference.m_users)
+    {
+        // isReviewer() is not virtual, so the kind of user is told apart by its type
+        const bool reviewing = dynamic_cast<const Reviewer*>(user.get()) != nullptr;
+        userIds.emplace(user.get(), static_cast<std::uint32_t>(users.size()));
+        users.push_back({strings.intern(user->fullNames()),
+                         strings.intern(user->affiliation()),
+                         strings.intern(user->email()),
+                         static_cast<std::uint8_t>((user->isChair() ? Chair : 0) | (user->isAuthor() ? Author : 0) |
+                                                   (reviewing ? Reviewing : 0)),
+                         {}});
+    }
+
+    for (const auto& track : conference.m_tracks)
+    {
+        TrackRecord record{};
+        record.topic = strings.intern(track->trackName());
+        record.type = dynamic_cast<const TrackWorkshop*>(track.get()) != nullptr ? 1
+                      : dynamic_cast<const TrackPoster*>(track.get()) != nullptr ? 2
+                                                                                 : 0;
+        record.state = stateCode(track->state());
+
+        record.firstArticle = static_cast<std::uint32_t>(articles.size());
+        record.articleCount = static_cast<std::uint32_t>(track->articles().size());
+        for (const auto& article : track->articles())
+        {
+            ArticleRecord articleRecord{};
+            articleRecord.title = strings.intern(article->articleName());
+            articleRecord.attachedUrl = strings.intern(article->attachedUrl());
+            if (const auto* poster = dynamic_cast<const ArticlePoster*>(article.get()))
+            {
+                articleRecord.type = 1;
+                articleRecord.detail = strings.intern(poster->secondAttachment());
+            }
+            else if (const auto* regular = dynamic_cast<const ArticleRegular*>(article.get()))
+            {
+                articleRecord.detail = strings.intern(regular->abstract());
+            }
+            articleRecord.firstAuthor = static_cast<std::uint32_t>(authors.size());
+            articleRecord.authorCount = static_cast<std::uint32_t>(article->authors().size());
+            for (const auto& author : article->authors())
+            {
+                authors.push_back(strings.intern(author));
+            }
+            articles.push_back(articleRecord);
+        }
+
+        record.firstReviewer = static_cast<std::uint32_t>(trackReviewers.size());
+        record.reviewerCount = static_cast<std::uint32_t>(track->reviewers().size());
+        for (const auto& reviewer : track->reviewers())
+        {
+            const auto user = userIds.find(reviewer.get());
+            if (user == userIds.end())
+            {
+                throw std::runtime_error("Cannot write snapshot: reviewer '" + reviewer->fullNames() +
+                                         "' of track '" + track->trackName() + "' is not a user of the conference");
+            }
+            trackReviewers.push_back(user->second);
+        }
+
+        const auto& bidMatrix = track->bidMatrix();
+        record.bidReviewers = static_cast<std::uint32_t>(bidMatrix.reviewers());
+        record.bidArticles = static_cast<std::uint32_t>(bidMatrix.articles());
+        record.firstBid = bids.size();
+        for (ArticleId article = 0; article < bidMatrix.articles(); ++article)
+        {
+            const auto articleBids = bidMatrix.articleBids(article);
+            bids.insert(bids.end(), articleBids.begin(), articleBids.end());
+        }
+
+        record.firstReview = static_cast<std::uint32_t>(reviews.size());
+        // Each text of the track is copied into the string table once, however many reviews share it. The id 0
+        // of the table is the empty string, so it also marks the texts not copied yet.
+        const auto& store = track->reviewStore();
+        std::vector<std::uint32_t> texts(store.texts(), 0);
+        for (ArticleId article = 0; article < store.articles(); ++article)
+        {
+            for (const auto index : store.articleReviews(article))
+            {
+                const auto& review = store[index];
+                if (texts[review.text] == 0)
+                {
+                    texts[review.text] = strings.intern(std::string(store.text(review.text)));
+                }
+                reviews.push_back({review.reviewer, article, texts[review.text],
+                                   static_cast<std::int8_t>(review.rating),
+                                   static_cast<std::uint8_t>(review.confidence), 0});
+            }
+        }
+        record.reviewCount = static_cast<std::uint32_t>(reviews.size()) - record.firstReview;
+        tracks.push_back(record);
+    }
+
+    SnapshotHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.seed = conference.m_seed;
+    header.createdAt =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(conference.m_createdAt.time_since_epoch()).count();
+
+    // Write next to the destination, then move the complete file into place
+    const auto temporary = path + ".tmp";
+    {
+        std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+        if (!output)
+        {
+            throw std::runtime_error("Cannot write snapshot: " + temporary);
+        }
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        const auto offsets = strings.offsets();
+        auto& sections = header.sections;
+        writeSection(output, sections[static_cast<size_t>(Section::StringOffsets)], std::span(offsets));
+        writeSection(output, sections[static_cast<size_t>(Section::StringData)],
+                     std::span(strings.data().data(), strings.data().size()));
+        writeSection(output, sections[static_cast<size_t>(Section::Users)], std::span<const UserRecord>(users));
+        writeSection(output, sections[static_cast<size_t>(Section::Tracks)], std::span<const TrackRecord>(tracks));
+        writeSection(output, sections[static_cast<size_t>(Section::Articles)],
+                     std::span<const ArticleRecord>(articles));
+        writeSection(output, sections[static_cast<size_t>(Section::Authors)], std::span<const std::uint32_t>(authors));
+        writeSection(output, sections[static_cast<size_t>(Section::TrackReviewers)],
+                     std::span<const std::uint32_t>(trackReviewers));
+        writeSection(output, sections[static_cast<size_t>(Section::Bids)], std::span<const BiddingInterest>(bids));
+        writeSection(output, sections[static_cast<size_t>(Section::Reviews)],
+                     std::span<const ReviewRecord>(reviews));
+
+        header.fileSize = static_cast<std::uint64_t>(output.tellp());
+        output.seekp(0);
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!output.flush())
+        {
+            throw std::runtime_error("Cannot write snapshot: " + temporary);
+        }
+    }
+
+    // The content must be on disk before the rename replaces the old snapshot, and the rename itself must be
+    // on disk before the write returns
+    syncPath(temporary);
+    std::filesystem::rename(temporary, path);
+    const auto directory = std::filesystem::absolute(path).parent_path();
+    syncPath(directory.string());
+}
+
+std::shared_ptr<Conference> ConferenceSnapshot::load(const std::string& path)
+{
+    const MappedFile file(path);
+    const SnapshotReader reader(file.bytes());
+    const auto& header = reader.header();
+
+    const auto users = reader.section<UserRecord>(Section::Users);
+    const auto tracks = reader.section<TrackRecord>(Section::Tracks);
+    const auto articles = reader.section<ArticleRecord>(Section::Articles);
+    const auto authors = reader.section<std::uint32_t>(Section::Authors);
+    const auto trackReviewers = reader.section<std::uint32_t>(Section::TrackReviewers);
+    const auto bids = reader.section<std::uint8_t>(Section::Bids);
+    const auto reviews = reader.section<ReviewRecord>(Section::Reviews);
+
+    auto conference = std::make_shared<Conference>();
+    conference->m_seed = header.seed;
+    conference->m_createdAt = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.createdAt)));
+
+    conference->m_users.reserve(users.size());
+    for (const auto& record : users)
+    {
+        // Built in place rather than from JSON, the passwords are not saved so restored users have none
+        std::shared_ptr<Reviewer> reviewer;
+        std::shared_ptr<User> user;
+        if ((record.flags & Reviewing) != 0)
+        {
+            reviewer = std::make_shared<Reviewer>();
+            user = reviewer;
+        }
+        else
+        {
+            user = std::make_shared<User>();
+        }
+        user->m_fullNames = reader.string(record.name);
+        user->m_affiliation = reader.string(record.affiliation);
+        user->m_email = reader.string(record.email);
+        user->m_isChair = (record.flags & Chair) != 0;
+        user->m_isAuthor = (record.flags & Author) != 0;
+        if (reviewer != nullptr)
+        {
+            reviewer->seed(conference->m_seed);
+            conference->m_reviewers.insert({reviewer->fullNames(), reviewer});
+        }
+        conference->m_conflicts->addUser(*user);
+        conference->m_users.push_back(std::move(user));
+    }
+
+    for (const auto& record : tracks)
+    {
+        if (record.type >= TRACK_TYPES.size())
+        {
+            SnapshotReader::fail("unknown track type " + std::to_string(record.type));
+        }
+        auto track = TrackFactory::createTrack(
+            {{"trackType", TRACK_TYPES[record.type]}, {"trackTopic", reader.string(record.topic)}});
+
+        SnapshotReader::range(record.firstReviewer, record.reviewerCount, trackReviewers.size());
+        for (const auto user : trackReviewers.subspan(record.firstReviewer, record.reviewerCount))
+        {
+            if (user >= conference->m_users.size())
+            {
+                SnapshotReader::fail("user id out of range");
+            }
+            track->addReviewer(conference->m_users[user]);
+        }
+
+        SnapshotReader::range(record.firstArticle, record.articleCount, articles.size());
+        std::vector<std::shared_ptr<Article>> trackArticles;
+        trackArticles.reserve(record.articleCount);
+        for (const auto& article : articles.subspan(record.firstArticle, record.articleCount))
+        {
+            SnapshotReader::range(article.firstAuthor, article.authorCount, authors.size());
+            std::vector<std::string> names;
+            names.reserve(article.authorCount);
+            for (const auto author : authors.subspan(article.firstAuthor, article.authorCount))
+            {
+                names.emplace_back(reader.string(author));
+            }
+
+            if (article.type == 1)
+            {
+                trackArticles.push_back(std::make_shared<ArticlePoster>(
+                    std::string(reader.string(article.title)), std::string(reader.string(article.attachedUrl)),
+                    std::move(names), std::string(reader.string(article.detail))));
+            }
+            else
+            {
+                trackArticles.push_back(std::make_shared<ArticleRegular>(
+                    std::string(reader.string(article.title)), std::string(reader.string(article.attachedUrl)),
+                    std::move(names), std::string(reader.string(article.detail))));
+            }
+        }
+        if (!track->restoreArticles(trackArticles))
+        {
+            SnapshotReader::fail("track '" + track->trackName() + "' rejected some of its articles");
+        }
+
+        BidMatrix bidMatrix;
+        SnapshotReader::range(record.firstBid, std::uint64_t{record.bidReviewers} * record.bidArticles, bids.size());
+        bidMatrix.reset(record.bidReviewers, record.bidArticles);
+        auto cell = bids.begin() + static_cast<std::ptrdiff_t>(record.firstBid);
+        for (ArticleId article = 0; article < record.bidArticles; ++article)
+        {
+            for (ReviewerId reviewer = 0; reviewer < record.bidReviewers; ++reviewer, ++cell)
+            {
+                if (*cell > static_cast<std::uint8_t>(BiddingInterest::Interested))
+                {
+                    SnapshotReader::fail("bid out of range");
+                }
+                bidMatrix.set(reviewer, article, static_cast<BiddingInterest>(*cell));
+            }
+        }
+
+        SnapshotReader::range(record.firstReview, record.reviewCount, reviews.size());
+        ReviewStore articleReviews;
+        if (record.reviewCount > 0)
+        {
+            articleReviews.resize(record.articleCount);
+        }
+        for (const auto& review : reviews.subspan(record.firstReview, record.reviewCount))
+        {
+            if ((review.reviewer >= record.reviewerCount && review.reviewer != ReviewStore::NO_REVIEWER) ||
+                review.article >= record.articleCount || review.rating < -3 || review.rating > 3 ||
+                review.confidence < 1 || review.confidence > 3)
+            {
+                SnapshotReader::fail("review out of range");
+            }
+            articleReviews.add(review.reviewer, review.article,
+                               articleReviews.intern(reader.string(review.text)), static_cast<Rating>(review.rating),
+                               static_cast<Confidence>(review.confidence));
+        }
+
+        track->restoreResults(std::move(bidMatrix), std::move(articleReviews));
+        track->establishState(stateOf(record.state));
+        track->conflictIndex(conference->m_conflicts);
+        conference->m_tracks.push_back(std::move(track));
+    }
+    return conference;
+}
@@ -0,0 +1,119 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conflictIndex.hpp"
+#include "identifiers.hpp"
+#include "randomStream.hpp"
+#include <algorithm>
+
+namespace
+{
+constexpr size_t INITIAL_SLOTS = 64; /**< The size of the table of users once the first one is added. */
+} // namespace
+
+bool ConflictIndex::addUser(const User& user)
+{
+    const auto& name = user.fullNames();
+    const auto hash = RandomStream::hash(name);
+
+    // A registered name keeps its affiliation, registering it again only succeeds when it does not change
+    if (!m_people.empty())
+    {
+        const auto& registered = m_people[slotOf(hash, name)];
+        if (registered.affiliation != NO_AFFILIATION)
+        {
+            const auto affiliation = m_affiliations.find(user.affiliation());
+            return affiliation != m_affiliations.end() && affiliation->second == registered.affiliation;
+        }
+    }
+
+    const auto [affiliation, added] =
+        m_affiliations.try_emplace(user.affiliation(), static_cast<std::uint32_t>(m_affiliations.size()));
+
+    // Keep the table at most half full, so probe sequences stay short
+    if (2 * (m_names.size() + 1) > m_people.size())
+    {
+        auto people = std::move(m_people);
+        m_people.assign(std::max(INITIAL_SLOTS, 2 * people.size()), Person{});
+        for (const auto& person : people)
+        {
+            if (person.affiliation != NO_AFFILIATION)
+            {
+                m_people[slotOf(person.hash, m_names[person.name])] = person;
+            }
+        }
+    }
+
+    m_people[slotOf(hash, name)] = {hash, static_cast<std::uint32_t>(m_names.size()), affiliation->second};
+    m_names.push_back(name);
+    return true;
+}
+
+size_t ConflictIndex::size() const
+{
+    return m_names.size();
+}
+
+size_t ConflictIndex::mask(ConflictMask& mask, std::span<const std::shared_ptr<Article>> articles,
+                           const std::vector<std::shared_ptr<User>>& reviewers) const
+{
+    // Group the reviewers by affiliation, reviewers of unknown affiliations cannot be in conflict. The groups are
+    // only needed while the mask is built, so they come from the resource of the mask.
+    std::pmr::vector<std::uint32_t> groupOf(m_affiliations.size(), ConflictMask::NO_GROUP, mask.resource());
+    std::pmr::vector<std::uint32_t> reviewerGroups(reviewers.size(), ConflictMask::NO_GROUP, mask.resource());
+    std::uint32_t groups = 0;
+    for (ReviewerId reviewer = 0; reviewer < reviewers.size(); ++reviewer)
+    {
+        const auto affiliation = m_affiliations.find(reviewers[reviewer]->affiliation());
+        if (affiliation != m_affiliations.end())
+        {
+            auto& group = groupOf[affiliation->second];
+            if (group == ConflictMask::NO_GROUP)
+            {
+                group = groups++;
+            }
+            reviewerGroups[reviewer] = group;
+        }
+    }
+    mask.reset(reviewerGroups, groups, articles.size());
+
+    // Mask the colleagues of every author
+    for (ArticleId article = 0; article < articles.size() && groups > 0; ++article)
+    {
+        for (const auto& author : articles[article]->authors())
+        {
+            const auto affiliation = affiliationOf(author);
+            if (affiliation != NO_AFFILIATION && groupOf[affiliation] != ConflictMask::NO_GROUP)
+            {
+                mask.set(groupOf[affiliation], article);
+            }
+        }
+    }
+    return mask.count();
+}
+
+size_t ConflictIndex::slotOf(std::uint64_t hash, std::string_view name) const
+{
+    const auto mask = m_people.size() - 1;
+    auto slot = RandomStream::mix(0, hash) & mask;
+    while (m_people[slot].affiliation != NO_AFFILIATION &&
+           (m_people[slot].hash != hash || m_names[m_people[slot].name] != name))
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+std::uint32_t ConflictIndex::affiliationOf(const std::string& name) const
+{
+    if (m_people.empty())
+    {
+        return NO_AFFILIATION;
+    }
+    return m_people[slotOf(RandomStream::hash(name), name)].affiliation;
+}
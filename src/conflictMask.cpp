@@ -0,0 +1,58 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conflictMask.hpp"
+
+ConflictMask::ConflictMask(std::pmr::memory_resource* resource)
+    : m_groups(resource), m_groupSizes(resource), m_bits(resource)
+{
+}
+
+void ConflictMask::reset(std::span<const std::uint32_t> reviewerGroups, size_t groups, size_t articles)
+{
+    m_groups.assign(reviewerGroups.begin(), reviewerGroups.end());
+    m_groupSizes.assign(groups, 0);
+    for (const auto group : m_groups)
+    {
+        if (group != NO_GROUP)
+        {
+            ++m_groupSizes[group];
+        }
+    }
+    m_count = 0;
+    m_bits.assign((groups * articles + 63) / 64, 0);
+}
+
+bool ConflictMask::set(std::uint32_t group, size_t article)
+{
+    const auto index = article * m_groupSizes.size() + group;
+    auto& word = m_bits[index / 64];
+    const auto bit = std::uint64_t{1} << (index % 64);
+    if ((word & bit) != 0)
+    {
+        return false;
+    }
+    word |= bit;
+    m_count += m_groupSizes[group];
+    return true;
+}
+
+size_t ConflictMask::count() const
+{
+    return m_count;
+}
+
+bool ConflictMask::empty() const
+{
+    return m_bits.empty();
+}
+
+std::pmr::memory_resource* ConflictMask::resource() const
+{
+    return m_bits.get_allocator().resource();
+}
@@ -0,0 +1,126 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "leaderboard.hpp"
+#include <algorithm>
+
+namespace
+{
+constexpr std::size_t SCORE_LEVELS =
+    Leaderboard::HIGHEST_KEY - Leaderboard::LOWEST_KEY + 1; /**< The number of distinct score keys. */
+} // namespace
+
+Leaderboard::Leaderboard() : m_levels(SCORE_LEVELS + 1)
+{
+}
+
+void Leaderboard::resize(std::size_t articles)
+{
+    for (auto article = static_cast<ArticleId>(articles); article < m_scores.size(); ++article)
+    {
+        if (!m_scores[article].empty())
+        {
+            m_ranking.erase({-m_scores[article].scoreKey(), article});
+            count(m_scores[article].scoreKey(), -1);
+        }
+    }
+    m_scores.resize(articles);
+}
+
+void Leaderboard::clear()
+{
+    m_scores.clear();
+    m_ranking.clear();
+    std::fill(m_levels.begin(), m_levels.end(), 0);
+}
+
+const ReviewAggregate& Leaderboard::add(ArticleId article, const Review& review)
+{
+    return add(article, review.rating(), review.confidence());
+}
+
+const ReviewAggregate& Leaderboard::add(ArticleId article, Rating rating, Confidence confidence)
+{
+    auto& score = m_scores[article];
+    if (!score.empty())
+    {
+        m_ranking.erase({-score.scoreKey(), article});
+        count(score.scoreKey(), -1);
+    }
+    score.add(rating, confidence);
+    m_ranking.emplace(-score.scoreKey(), article);
+    count(score.scoreKey(), 1);
+    return score;
+}
+
+std::size_t Leaderboard::size() const
+{
+    return m_scores.size();
+}
+
+bool Leaderboard::empty() const
+{
+    return m_scores.empty();
+}
+
+const ReviewAggregate& Leaderboard::operator[](ArticleId article) const
+{
+    return m_scores[article];
+}
+
+std::span<const ReviewAggregate> Leaderboard::scores() const
+{
+    return m_scores;
+}
+
+std::size_t Leaderboard::reviewed() const
+{
+    return m_ranking.size();
+}
+
+std::size_t Leaderboard::atOrAbove(std::int32_t scoreKey) const
+{
+    return reviewed() - below(std::clamp(scoreKey, LOWEST_KEY, HIGHEST_KEY + 1));
+}
+
+std::size_t Leaderboard::rank(ArticleId article) const
+{
+    if (article >= m_scores.size() || m_scores[article].empty())
+    {
+        return 0;
+    }
+    return atOrAbove(m_scores[article].scoreKey() + 1) + 1;
+}
+
+void Leaderboard::top(std::size_t count, std::vector<ArticleId>& articles) const
+{
+    articles.resize(std::min(count, m_ranking.size()));
+    auto entry = m_ranking.begin();
+    for (auto& article : articles)
+    {
+        article = (entry++)->second;
+    }
+}
+
+void Leaderboard::count(std::int32_t scoreKey, std::int32_t delta)
+{
+    for (auto node = static_cast<std::size_t>(scoreKey - LOWEST_KEY) + 1; node < m_levels.size(); node += node & -node)
+    {
+        m_levels[node] += delta;
+    }
+}
+
+std::size_t Leaderboard::below(std::int32_t scoreKey) const
+{
+    std::int32_t articles = 0;
+    for (auto node = static_cast<std::size_t>(scoreKey - LOWEST_KEY); node > 0; node -= node & -node)
+    {
+        articles += m_levels[node];
+    }
+    return static_cast<std::size_t>(articles);
+}
@@ -6,7 +6,195 @@
  * MIT License
  */
 
+#include "conferenceGenerator.hpp"
+#include "conferenceLoader.hpp"
+#include "conferenceManager.hpp"
+#include "reportSinkNull.hpp"
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr auto USAGE = R"(Usage: ComfyChairCpp generate [options]
+       ComfyChairCpp simulate <conference.json> [--threads <count>] [--metrics <path>]
+
+simulate runs the bidding and review of a conference document, then writes the metrics of
+the phases as JSON if the path ends with .json, in the Prometheus text format otherwise.
+
+generate writes a synthetic conference document, readable by the ConferenceLoader.
+
+Options, applied in order:
+  --production               Start from the shape of a large production conference
+  --tracks <count>           Number of tracks
+  --articles <count>         Articles submitted to each track
+  --reviewers <count>        Reviewers of the conference
+  --reviewers-per-track <n>  Reviewers of each track, 0 for every reviewer
+  --reviews <count>          Reviews of each article
+  --authors <count>          Authors, who are not reviewers
+  --affiliations <count>     Affiliations shared by the users
+  --affiliation-skew <s>     Zipf exponent of the affiliation sizes
+  --author-skew <s>          Zipf exponent of the articles per author
+  --bid-skew <s>             Exponent of the bid rates of the reviewers, 0 for none
+  --seed <seed>              Seed of the conference
+  --output <path>            Write to a file instead of the standard output
+)";
+
+/**
+ * @brief Generate a conference document from the command line.
+ * @param arguments The arguments following the "generate" command.
+ * @return The exit status of the program.
+ */
+int generate(const std::vector<std::string_view>& arguments)
+{
+    ConferenceShape shape;
+    std::string output;
+    const std::map<std::string_view, std::function<void(const std::string&)>> options{
+        {"--tracks", [&](const std::string& value) { shape.tracks = std::stoull(value); }},
+        {"--articles", [&](const std::string& value) { shape.articles = std::stoull(value); }},
+        {"--reviewers", [&](const std::string& value) { shape.reviewers = std::stoull(value); }},
+        {"--reviewers-per-track", [&](const std::string& value) { shape.reviewersPerTrack = std::stoull(value); }},
+        {"--reviews", [&](const std::string& value) { shape.reviewsPerArticle = std::stoul(value); }},
+        {"--authors", [&](const std::string& value) { shape.authors = std::stoull(value); }},
+        {"--affiliations", [&](const std::string& value) { shape.affiliations = std::stoull(value); }},
+        {"--affiliation-skew", [&](const std::string& value) { shape.affiliationSkew = std::stod(value); }},
+        {"--author-skew", [&](const std::string& value) { shape.authorSkew = std::stod(value); }},
+        {"--bid-skew", [&](const std::string& value) { shape.bidSkew = std::stod(value); }},
+        {"--seed", [&](const std::string& value) { shape.seed = std::stoull(value); }},
+        {"--output", [&](const std::string& value) { output = value; }}};
+
+    for (size_t argument = 0; argument < arguments.size(); ++argument)
+    {
+        if (arguments[argument] == "--production")
+        {
+            shape = ConferenceShape::production();
+            continue;
+        }
+        const auto option = options.find(arguments[argument]);
+        if (option == options.end() || argument + 1 == arguments.size())
+        {
+            std::cerr << "Invalid option: " << arguments[argument] << "\n\n" << USAGE;
+            return 1;
+        }
+        try
+        {
+            option->second(std::string(arguments[++argument]));
+        }
+        catch (const std::exception&)
+        {
+            std::cerr << "Invalid value for " << option->first << ": " << arguments[argument] << '\n';
+            return 1;
+        }
+    }
+
+    const ConferenceGenerator generator(shape);
+    if (output.empty())
+    {
+        generator.write(std::cout);
+        return std::cout ? 0 : 1;
+    }
+    std::ofstream file(output, std::ios::binary);
+    generator.write(file);
+    if (!file)
+    {
+        std::cerr << "Cannot write conference file: " << output << '\n';
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Run the phases of a conference document and export their metrics.
+ * @param arguments The arguments following the "simulate" command.
+ * @return The exit status of the program.
+ */
+int simulate(const std::vector<std::string_view>& arguments)
+{
+    std::string input;
+    std::string metrics;
+    size_t threads = std::thread::hardware_concurrency();
+    for (size_t argument = 0; argument < arguments.size(); ++argument)
+    {
+        if (arguments[argument] == "--threads" && argument + 1 < arguments.size())
+        {
+            try
+            {
+                threads = std::stoull(std::string(arguments[++argument]));
+            }
+            catch (const std::exception&)
+            {
+                std::cerr << "Invalid value for --threads: " << arguments[argument] << '\n';
+                return 1;
+            }
+        }
+        else if (arguments[argument] == "--metrics" && argument + 1 < arguments.size())
+        {
+            metrics = arguments[++argument];
+        }
+        else if (input.empty() && !arguments[argument].starts_with("--"))
+        {
+            input = arguments[argument];
+        }
+        else
+        {
+            std::cerr << "Invalid option: " << arguments[argument] << "\n\n" << USAGE;
+            return 1;
+        }
+    }
+    if (input.empty())
+    {
+        std::cerr << USAGE;
+        return 1;
+    }
+
+    try
+    {
+        const auto conference = ConferenceLoader::load(input);
+        conference->reportSink(std::make_shared<ReportSinkNull>());
+        ConferenceManager manager(conference, threads);
+        manager.startBidding(std::chrono::system_clock::now());
+        manager.runBidding();
+        manager.startRevision(std::chrono::system_clock::now());
+        manager.runReview();
+        manager.startSelection(std::chrono::system_clock::now());
+        if (metrics.empty())
+        {
+            Metrics::global().writePrometheus(std::cout);
+        }
+        else
+        {
+            Metrics::global().write(metrics);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
+} // namespace
+
 int main(const int argc, const char* argv[])
 {
+    if (argc > 1 && std::string_view(argv[1]) == "generate")
+    {
+        return generate({argv + 2, argv + argc});
+    }
+    if (argc > 1 && std::string_view(argv[1]) == "simulate")
+    {
+        return simulate({argv + 2, argv + argc});
+    }
+    if (argc > 1)
+    {
+        std::cerr << USAGE;
+        return 1;
+    }
     return 0;
 }
@@ -0,0 +1,349 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "metrics.hpp"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Format a number in its shortest exact form.
+ * @param value The number.
+ * @return The text of the number, as Prometheus and JSON read it.
+ */
+std::string formatNumber(double value)
+{
+    std::array<char, 32> text{};
+    const auto end = std::to_chars(text.data(), text.data() + text.size(), value).ptr;
+    return {text.data(), end};
+}
+
+/**
+ * @brief Write the labels of a series in the Prometheus format.
+ * @param output The stream receiving the labels.
+ * @param labels The labels of the series.
+ * @param bound The upper bound of a histogram bucket, if any, written as the "le" label.
+ */
+void writeLabels(std::ostream& output, const MetricLabels& labels, std::string_view bound = {})
+{
+    if (labels.empty() && bound.empty())
+    {
+        return;
+    }
+    output << '{';
+    auto separator = "";
+    for (const auto& [name, value] : labels)
+    {
+        output << separator << name << "=\"";
+        for (const auto character : value)
+        {
+            switch (character)
+            {
+            case '\\':
+                output << "\\\\";
+                break;
+            case '"':
+                output << "\\\"";
+                break;
+            case '\n':
+                output << "\\n";
+                break;
+            default:
+                output << character;
+            }
+        }
+        output << '"';
+        separator = ",";
+    }
+    if (!bound.empty())
+    {
+        output << separator << "le=\"" << bound << '"';
+    }
+    output << '}';
+}
+
+/**
+ * @brief Describe the labels of a series in JSON.
+ * @param labels The labels of the series.
+ * @return An object with a member per label.
+ */
+nlohmann::json labelsJson(const MetricLabels& labels)
+{
+    auto object = nlohmann::json::object();
+    for (const auto& [name, value] : labels)
+    {
+        object[name] = value;
+    }
+    return object;
+}
+} // namespace
+
+std::uint64_t Counter::value() const
+{
+    return m_value.load(std::memory_order_relaxed);
+}
+
+void Counter::reset()
+{
+    m_value.store(0, std::memory_order_relaxed);
+}
+
+void Gauge::set(double value)
+{
+    if constexpr (METRICS_ENABLED)
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+}
+
+double Gauge::value() const
+{
+    return m_value.load(std::memory_order_relaxed);
+}
+
+void Gauge::reset()
+{
+    m_value.store(0.0, std::memory_order_relaxed);
+}
+
+void Histogram::observe(double seconds)
+{
+    if constexpr (METRICS_ENABLED)
+    {
+        const auto bucket = std::lower_bound(BOUNDS.begin(), BOUNDS.end(), seconds) - BOUNDS.begin();
+        m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(seconds, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t Histogram::count() const
+{
+    return cumulative(BOUNDS.size());
+}
+
+double Histogram::sum() const
+{
+    return m_sum.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::cumulative(std::size_t bound) const
+{
+    std::uint64_t observations = 0;
+    for (std::size_t bucket = 0; bucket <= bound; ++bucket)
+    {
+        observations += m_buckets[bucket].load(std::memory_order_relaxed);
+    }
+    return observations;
+}
+
+void Histogram::reset()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0.0, std::memory_order_relaxed);
+}
+
+ScopedTimer::ScopedTimer(Histogram* histogram) : m_histogram(histogram)
+{
+    if (m_histogram != nullptr)
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    if (m_histogram != nullptr)
+    {
+        m_histogram->observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count());
+    }
+}
+
+Metrics& Metrics::global()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+template <typename Series>
+Series& Metrics::series(std::map<MetricLabels, std::unique_ptr<Series>>& family, const MetricLabels& labels)
+{
+    auto& series = family[labels];
+    if (series == nullptr)
+    {
+        series = std::make_unique<Series>();
+    }
+    return *series;
+}
+
+Counter& Metrics::counter(std::string_view name, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return series(m_counters.try_emplace(std::string(name)).first->second, labels);
+}
+
+Gauge& Metrics::gauge(std::string_view name, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return series(m_gauges.try_emplace(std::string(name)).first->second, labels);
+}
+
+Histogram& Metrics::histogram(std::string_view name, const MetricLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return series(m_histograms.try_emplace(std::string(name)).first->second, labels);
+}
+
+void Metrics::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& [name, family] : m_counters)
+    {
+        for (auto& [labels, counter] : family)
+        {
+            counter->reset();
+        }
+    }
+    for (auto& [name, family] : m_gauges)
+    {
+        for (auto& [labels, gauge] : family)
+        {
+            gauge->reset();
+        }
+    }
+    for (auto& [name, family] : m_histograms)
+    {
+        for (auto& [labels, histogram] : family)
+        {
+            histogram->reset();
+        }
+    }
+}
+
+void Metrics::writeJson(std::ostream& output) const
+{
+    nlohmann::json document = {{"counters", nlohmann::json::array()},
+                               {"gauges", nlohmann::json::array()},
+                               {"histograms", nlohmann::json::array()}};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [name, family] : m_counters)
+    {
+        for (const auto& [labels, counter] : family)
+        {
+            document["counters"].push_back(
+                {{"name", name}, {"labels", labelsJson(labels)}, {"value", counter->value()}});
+        }
+    }
+    for (const auto& [name, family] : m_gauges)
+    {
+        for (const auto& [labels, gauge] : family)
+        {
+            document["gauges"].push_back({{"name", name}, {"labels", labelsJson(labels)}, {"value", gauge->value()}});
+        }
+    }
+    for (const auto& [name, family] : m_histograms)
+    {
+        for (const auto& [labels, histogram] : family)
+        {
+            auto buckets = nlohmann::json::array();
+            for (std::size_t bound = 0; bound < Histogram::BOUNDS.size(); ++bound)
+            {
+                buckets.push_back({{"le", Histogram::BOUNDS[bound]}, {"count", histogram->cumulative(bound)}});
+            }
+            document["histograms"].push_back({{"name", name},
+                                              {"labels", labelsJson(labels)},
+                                              {"count", histogram->count()},
+                                              {"sum", histogram->sum()},
+                                              {"buckets", std::move(buckets)}});
+        }
+    }
+    output << document.dump(2) << '\n';
+}
+
+void Metrics::writePrometheus(std::ostream& output) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [name, family] : m_counters)
+    {
+        output << "# TYPE " << name << " counter\n";
+        for (const auto& [labels, counter] : family)
+        {
+            output << name;
+            writeLabels(output, labels);
+            output << ' ' << counter->value() << '\n';
+        }
+    }
+    for (const auto& [name, family] : m_gauges)
+    {
+        output << "# TYPE " << name << " gauge\n";
+        for (const auto& [labels, gauge] : family)
+        {
+            output << name;
+            writeLabels(output, labels);
+            output << ' ' << formatNumber(gauge->value()) << '\n';
+        }
+    }
+    for (const auto& [name, family] : m_histograms)
+    {
+        output << "# TYPE " << name << " histogram\n";
+        for (const auto& [labels, histogram] : family)
+        {
+            for (std::size_t bound = 0; bound < Histogram::BOUNDS.size(); ++bound)
+            {
+                output << name << "_bucket";
+                writeLabels(output, labels, formatNumber(Histogram::BOUNDS[bound]));
+                output << ' ' << histogram->cumulative(bound) << '\n';
+            }
+            output << name << "_bucket";
+            writeLabels(output, labels, "+Inf");
+            output << ' ' << histogram->count() << '\n';
+            output << name << "_sum";
+            writeLabels(output, labels);
+            output << ' ' << formatNumber(histogram->sum()) << '\n';
+            output << name << "_count";
+            writeLabels(output, labels);
+            output << ' ' << histogram->count() << '\n';
+        }
+    }
+}
+
+void Metrics::write(const std::string& path) const
+{
+    std::ofstream output(path, std::ios::binary);
+    if (path.ends_with(".json"))
+    {
+        writeJson(output);
+    }
+    else
+    {
+        writePrometheus(output);
+    }
+    if (!output)
+    {
+        throw std::invalid_argument("Cannot write metrics file: " + path);
+    }
+}
+
+std::size_t Metrics::heapInUse()
+{
+#ifdef __GLIBC__
+    const auto heap = mallinfo2();
+    return heap.uordblks + heap.hblkhd;
+#else
+    return 0;
+#endif
+}
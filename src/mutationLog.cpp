@@ -0,0 +1,588 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "mutationLog.hpp"
+#include "articlePoster.hpp"
+#include "articleRegular.hpp"
+#include "conference.hpp"
+#include "trackPhase.hpp"
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unistd.h>
+#include <utility>
+
+namespace
+{
+constexpr size_t FRAME_SIZE = 2 * sizeof(std::uint32_t); /**< The length and checksum before each record. */
+
+/**
+ * @brief Kinds of records of the log.
+ */
+enum class RecordKind : std::uint8_t
+{
+    Article, /**< An operation on an article. */
+    Bids,    /**< The bids of a track that changed in a bidding phase. */
+    State,   /**< A state transition of a track. */
+    Review   /**< One review of an article of a track, with its reviewer. */
+};
+
+/**
+ * @brief Compute the CRC-32 of some bytes.
+ * @param data The bytes.
+ * @return The checksum.
+ */
+std::uint32_t crc32(std::string_view data)
+{
+    static const auto table = [] {
+        std::array<std::uint32_t, 256> table{};
+        for (std::uint32_t entry = 0; entry < table.size(); ++entry)
+        {
+            auto value = entry;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                value = (value & 1) != 0 ? 0xEDB88320U ^ (value >> 1) : value >> 1;
+            }
+            table[entry] = value;
+        }
+        return table;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFU;
+    for (const auto byte : data)
+    {
+        crc = table[(crc ^ static_cast<std::uint8_t>(byte)) & 0xFFU] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/**
+ * @class RecordWriter
+ * @brief Encoder of the content of a record.
+ */
+class RecordWriter
+{
+  public:
+    RecordWriter(RecordKind kind, std::uint32_t track)
+    {
+        integer(static_cast<std::uint8_t>(kind));
+        integer(track);
+    }
+
+    /**
+     * @brief Append an integer, in the byte order of the machine.
+     * @param value The integer.
+     */
+    template <typename T> void integer(T value)
+    {
+        m_record.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    /**
+     * @brief Append a string, preceded by its length.
+     * @param text The string.
+     */
+    void string(std::string_view text)
+    {
+        integer(static_cast<std::uint32_t>(text.size()));
+        m_record += text;
+    }
+
+    /**
+     * @brief Get the encoded record.
+     * @return The content of the record.
+     */
+    const std::string& record() const
+    {
+        return m_record;
+    }
+
+  private:
+    std::string m_record; /**< The content of the record. */
+};
+
+/**
+ * @class RecordReader
+ * @brief Decoder of the content of a record.
+ */
+class RecordReader
+{
+  public:
+    explicit RecordReader(std::string_view record) : m_record(record)
+    {
+    }
+
+    /**
+     * @brief Read an integer.
+     * @return The integer.
+     */
+    template <typename T> T integer()
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(value)).data(), sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Read a string.
+     * @return The string.
+     */
+    std::string string()
+    {
+        return std::string(take(integer<std::uint32_t>()));
+    }
+
+    /**
+     * @brief Check whether the whole record was read.
+     * @return True if no byte is left.
+     */
+    bool empty() const
+    {
+        return m_record.empty();
+    }
+
+  private:
+    /**
+     * @brief Consume some bytes of the record.
+     * @param size The number of bytes.
+     * @return The bytes.
+     */
+    std::string_view take(size_t size)
+    {
+        if (size > m_record.size())
+        {
+            throw std::runtime_error("Invalid mutation log: record too short");
+        }
+        const auto bytes = m_record.substr(0, size);
+        m_record.remove_prefix(size);
+        return bytes;
+    }
+
+    std::string_view m_record; /**< The bytes left to read. */
+};
+
+/**
+ * @brief Create the state of a track from its name.
+ * @param name The name of the state.
+ * @return The state.
+ */
+TrackPhase stateNamed(const std::string& name)
+{
+    if (const auto phase = TrackPhase::named(name))
+    {
+        return *phase;
+    }
+    throw std::runtime_error("Invalid mutation log: unknown state " + name);
+}
+
+/**
+ * @brief Apply a record to a conference.
+ * @param record The content of the record.
+ * @param tracks The tracks of the conference.
+ */
+void apply(std::string_view record, const std::vector<std::shared_ptr<Track>>& tracks)
+{
+    RecordReader reader(record);
+    const auto kind = static_cast<RecordKind>(reader.integer<std::uint8_t>());
+    const auto index = reader.integer<std::uint32_t>();
+    if (index >= tracks.size())
+    {
+        throw std::runtime_error("Invalid mutation log: track " + std::to_string(index) + " out of range");
+    }
+    auto& track = *tracks[index];
+
+    switch (kind)
+    {
+    case RecordKind::Article: {
+        const auto operation = static_cast<OperationType>(reader.integer<std::uint8_t>());
+        const bool poster = reader.integer<std::uint8_t>() != 0;
+        auto title = reader.string();
+        auto url = reader.string();
+        std::vector<std::string> authors(reader.integer<std::uint32_t>());
+        for (auto& author : authors)
+        {
+            author = reader.string();
+        }
+        auto detail = reader.string();
+
+        std::shared_ptr<Article> article;
+        if (poster)
+        {
+            article = std::make_shared<ArticlePoster>(std::move(title), std::move(url), std::move(authors),
+                                                      std::move(detail));
+        }
+        else
+        {
+            article = std::make_shared<ArticleRegular>(std::move(title), std::move(url), std::move(authors),
+                                                       std::move(detail));
+        }
+        track.handleTrackArticle(article, operation);
+        break;
+    }
+    case RecordKind::Bids: {
+        // The cells that changed, on top of the bids of the track or of no bid for a matrix of new dimensions
+        const auto reviewers = reader.integer<std::uint32_t>();
+        const auto articles = reader.integer<std::uint32_t>();
+        BidMatrix bids;
+        if (reader.integer<std::uint8_t>() != 0)
+        {
+            bids.reset(reviewers, articles);
+        }
+        else if (track.bidMatrix().reviewers() == reviewers && track.bidMatrix().articles() == articles)
+        {
+            bids = track.bidMatrix();
+        }
+        else
+        {
+            throw std::runtime_error("Invalid mutation log: bids do not match the track");
+        }
+        while (!reader.empty())
+        {
+            const auto article = reader.integer<std::uint32_t>();
+            const auto reviewer = reader.integer<std::uint32_t>();
+            const auto interest = static_cast<BiddingInterest>(reader.integer<std::uint8_t>());
+            if (article >= articles || reviewer >= reviewers)
+            {
+                throw std::runtime_error("Invalid mutation log: bid out of range");
+            }
+            bids.set(reviewer, article, interest);
+        }
+        track.restoreBids(std::move(bids));
+        break;
+    }
+    case RecordKind::State:
+        track.establishState(stateNamed(reader.string()));
+        break;
+    case RecordKind::Review: {
+        const auto reviewer = reader.integer<std::uint32_t>();
+        const auto article = reader.integer<std::uint32_t>();
+        auto text = reader.string();
+        const auto rating = static_cast<Rating>(reader.integer<std::int8_t>());
+        const Review review(std::move(text), rating, static_cast<Confidence>(reader.integer<std::uint8_t>()));
+        if (reviewer != ReviewStore::NO_REVIEWER && reviewer >= track.reviewers().size())
+        {
+            throw std::runtime_error("Invalid mutation log: reviewer " + std::to_string(reviewer) + " out of range");
+        }
+        if (!track.restoreReview(reviewer, article, review))
+        {
+            throw std::runtime_error("Invalid mutation log: review of unknown article " + std::to_string(article));
+        }
+        break;
+    }
+    default:
+        throw std::runtime_error("Invalid mutation log: unknown record kind");
+    }
+}
+} // namespace
+
+MutationLog::MutationLog(const std::string& path, std::chrono::microseconds commitDelay) : m_delay(commitDelay)
+{
+    m_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (m_descriptor < 0)
+    {
+        throw std::runtime_error("Cannot open mutation log: " + path);
+    }
+    m_flusher = std::thread(&MutationLog::flush, this);
+}
+
+MutationLog::~MutationLog()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_pending.notify_one();
+    m_flusher.join();
+    ::close(m_descriptor);
+}
+
+std::uint64_t MutationLog::append(const std::string& record)
+{
+    std::array<std::uint32_t, 2> frame{static_cast<std::uint32_t>(record.size()), crc32(record)};
+    std::uint64_t sequence = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error.empty())
+        {
+            throw std::runtime_error(m_error);
+        }
+        m_buffer.append(reinterpret_cast<const char*>(frame.data()), FRAME_SIZE);
+        m_buffer += record;
+        sequence = ++m_appended;
+    }
+    m_pending.notify_one();
+    return sequence;
+}
+
+void MutationLog::commit(std::uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_durable.wait(lock, [this, sequence] { return m_synced >= sequence || !m_error.empty(); });
+    if (m_synced < sequence)
+    {
+        throw std::runtime_error(m_error);
+    }
+}
+
+void MutationLog::log(const std::string& record)
+{
+    commit(append(record));
+}
+
+void MutationLog::truncate()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_durable.wait(lock, [this] { return m_synced == m_appended || !m_error.empty(); });
+    if (!m_error.empty() || ::ftruncate(m_descriptor, 0) != 0 || ::fdatasync(m_descriptor) != 0)
+    {
+        throw std::runtime_error(m_error.empty() ? "Cannot truncate mutation log" : m_error);
+    }
+}
+
+std::uint64_t MutationLog::syncs() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_syncs;
+}
+
+void MutationLog::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_pending.wait(lock, [this] { return m_stopping || !m_buffer.empty(); });
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        if (m_delay.count() > 0 && !m_stopping)
+        {
+            // Let more submitters join the batch before paying for the sync
+            m_pending.wait_for(lock, m_delay, [this] { return m_stopping; });
+        }
+
+        std::string batch;
+        batch.swap(m_buffer);
+        const auto sequence = m_appended;
+        lock.unlock();
+
+        const char* error = nullptr;
+        for (size_t written = 0; written < batch.size() && error == nullptr;)
+        {
+            const auto result = ::write(m_descriptor, batch.data() + written, batch.size() - written);
+            if (result < 0 && errno != EINTR)
+            {
+                error = "Cannot write mutation log: ";
+            }
+            written += result > 0 ? static_cast<size_t>(result) : 0;
+        }
+        if (error == nullptr && ::fdatasync(m_descriptor) != 0)
+        {
+            error = "Cannot sync mutation log: ";
+        }
+
+        lock.lock();
+        if (error != nullptr)
+        {
+            m_error = error + std::string(std::strerror(errno));
+            m_durable.notify_all();
+            return;
+        }
+        m_synced = sequence;
+        ++m_syncs;
+        m_durable.notify_all();
+    }
+}
+
+size_t MutationLog::replay(const std::string& path, Conference& conference)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+        return 0;
+    }
+    const std::string log((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+
+    size_t records = 0;
+    size_t position = 0;
+    while (log.size() - position >= FRAME_SIZE)
+    {
+        std::array<std::uint32_t, 2> frame{};
+        std::memcpy(frame.data(), log.data() + position, FRAME_SIZE);
+        const auto [size, checksum] = frame;
+        if (size > log.size() - position - FRAME_SIZE)
+        {
+            break;
+        }
+        const std::string_view record(log.data() + position + FRAME_SIZE, size);
+        if (crc32(record) != checksum)
+        {
+            break;
+        }
+        apply(record, conference.tracks());
+        position += FRAME_SIZE + size;
+        ++records;
+    }
+
+    // Drop the record the crash cut short, so new records follow the last complete one
+    if (position < log.size())
+    {
+        std::filesystem::resize_file(path, position);
+    }
+    return records;
+}
+
+TrackJournal::TrackJournal(std::shared_ptr<MutationLog> log, std::uint32_t track)
+    : m_log(std::move(log)), m_track(track)
+{
+}
+
+void TrackJournal::article(const Article& article, OperationType operation, const TrackResult& result) const
+{
+    if (m_log == nullptr || !result)
+    {
+        return;
+    }
+
+    m_log->log(articleRecord(article, operation));
+}
+
+void TrackJournal::articles(std::span<const std::shared_ptr<Article>> articles, std::span<const TrackResult> results,
+                            OperationType operation) const
+{
+    if (m_log == nullptr)
+    {
+        return;
+    }
+
+    std::uint64_t last = 0;
+    for (size_t article = 0; article < articles.size(); ++article)
+    {
+        if (results[article])
+        {
+            last = m_log->append(articleRecord(*articles[article], operation));
+        }
+    }
+    if (last != 0)
+    {
+        m_log->commit(last);
+    }
+}
+
+std::string TrackJournal::articleRecord(const Article& article, OperationType operation) const
+{
+    RecordWriter writer(RecordKind::Article, m_track);
+    writer.integer(static_cast<std::uint8_t>(operation));
+    const auto* poster = dynamic_cast<const ArticlePoster*>(&article);
+    const auto* regular = dynamic_cast<const ArticleRegular*>(&article);
+    writer.integer(static_cast<std::uint8_t>(poster != nullptr));
+    writer.string(article.articleName());
+    writer.string(article.attachedUrl());
+    writer.integer(static_cast<std::uint32_t>(article.authors().size()));
+    for (const auto& author : article.authors())
+    {
+        writer.string(author);
+    }
+    writer.string(poster != nullptr ? poster->secondAttachment() : regular != nullptr ? regular->abstract() : "");
+    return writer.record();
+}
+
+void TrackJournal::bids(const BidMatrix& previous, const BidMatrix& bids) const
+{
+    if (m_log == nullptr)
+    {
+        return;
+    }
+
+    RecordWriter writer(RecordKind::Bids, m_track);
+    const bool reset = previous.reviewers() != bids.reviewers() || previous.articles() != bids.articles();
+    writer.integer(static_cast<std::uint32_t>(bids.reviewers()));
+    writer.integer(static_cast<std::uint32_t>(bids.articles()));
+    writer.integer(static_cast<std::uint8_t>(reset));
+    bool changed = reset;
+    for (ArticleId article = 0; article < bids.articles(); ++article)
+    {
+        const auto cells = bids.articleBids(article);
+        for (ReviewerId reviewer = 0; reviewer < cells.size(); ++reviewer)
+        {
+            const auto before = reset ? BiddingInterest::None : previous.at(reviewer, article);
+            if (cells[reviewer] != before)
+            {
+                writer.integer(article);
+                writer.integer(reviewer);
+                writer.integer(static_cast<std::uint8_t>(cells[reviewer]));
+                changed = true;
+            }
+        }
+    }
+    if (changed)
+    {
+        m_log->log(writer.record());
+    }
+}
+
+void TrackJournal::reviews(const ReviewStore& reviews, std::uint32_t first) const
+{
+    if (m_log == nullptr)
+    {
+        return;
+    }
+
+    std::uint64_t last = 0;
+    for (auto review = first; review < reviews.size(); ++review)
+    {
+        const auto& stored = reviews[review];
+        last = m_log->append(
+            reviewRecord(stored.reviewer, stored.article, reviews.text(stored.text), stored.rating, stored.confidence));
+    }
+    if (last != 0)
+    {
+        m_log->commit(last);
+    }
+}
+
+void TrackJournal::review(ArticleId article, const Review& review) const
+{
+    if (m_log == nullptr)
+    {
+        return;
+    }
+
+    m_log->log(
+        reviewRecord(ReviewStore::NO_REVIEWER, article, review.reviewText(), review.rating(), review.confidence()));
+}
+
+std::string TrackJournal::reviewRecord(ReviewerId reviewer, ArticleId article, std::string_view text, Rating rating,
+                                       Confidence confidence) const
+{
+    RecordWriter writer(RecordKind::Review, m_track);
+    writer.integer(reviewer);
+    writer.integer(article);
+    writer.string(text);
+    writer.integer(static_cast<std::int8_t>(rating));
+    writer.integer(static_cast<std::uint8_t>(confidence));
+    return writer.record();
+}
+
+void TrackJournal::state(std::string_view state) const
+{
+    if (m_log == nullptr)
+    {
+        return;
+    }
+
+    RecordWriter writer(RecordKind::State, m_track);
+    writer.string(state);
+    m_log->log(writer.record());
+}
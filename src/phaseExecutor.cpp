@@ -0,0 +1,122 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "phaseExecutor.hpp"
+
+PhaseExecutor::PhaseExecutor(size_t threads)
+{
+    for (size_t worker = 1; worker < threads; ++worker)
+    {
+        m_workers.emplace_back(&PhaseExecutor::work, this);
+    }
+}
+
+PhaseExecutor::~PhaseExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+size_t PhaseExecutor::threads() const
+{
+    return m_workers.size() + 1;
+}
+
+void PhaseExecutor::run(size_t tasks, const std::function<void(size_t)>& task)
+{
+    // Nothing to share, run inline without waking the workers
+    if (m_workers.empty() || tasks <= 1)
+    {
+        for (size_t index = 0; index < tasks; ++index)
+        {
+            task(index);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_tasks = tasks;
+        m_next.store(0, std::memory_order_relaxed);
+        m_busy = m_workers.size();
+        m_error = nullptr;
+        ++m_batch;
+    }
+    m_wake.notify_all();
+
+    drain();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_busy == 0; });
+        m_task = nullptr;
+        std::swap(error, m_error);
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void PhaseExecutor::work()
+{
+    std::uint64_t seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this, seen] { return m_stopping || m_batch != seen; });
+            if (m_stopping)
+            {
+                return;
+            }
+            seen = m_batch;
+        }
+
+        drain();
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            last = --m_busy == 0;
+        }
+        if (last)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+
+void PhaseExecutor::drain()
+{
+    for (auto index = m_next.fetch_add(1, std::memory_order_relaxed); index < m_tasks;
+         index = m_next.fetch_add(1, std::memory_order_relaxed))
+    {
+        try
+        {
+            (*m_task)(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error)
+            {
+                m_error = std::current_exception();
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "randomStream.hpp"
+
+namespace
+{
+constexpr std::uint32_t PHILOX_M0 = 0xD2511F53; /**< Multiplier of the first word pair. */
+constexpr std::uint32_t PHILOX_M1 = 0xCD9E8D57; /**< Multiplier of the second word pair. */
+constexpr std::uint32_t PHILOX_W0 = 0x9E3779B9; /**< Weyl increment of the first key word. */
+constexpr std::uint32_t PHILOX_W1 = 0xBB67AE85; /**< Weyl increment of the second key word. */
+constexpr int PHILOX_ROUNDS = 10;               /**< Rounds of the Philox4x32-10 variant. */
+} // namespace
+
+RandomStream::RandomStream(std::uint64_t key, std::uint64_t stream, std::uint32_t domain)
+    : m_key(key), m_counter{0, domain, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)}
+{
+}
+
+std::uint32_t RandomStream::next()
+{
+    if (m_used == m_block.size())
+    {
+        m_block = philox(m_counter, m_key);
+        ++m_counter[0];
+        m_used = 0;
+    }
+    return m_block[m_used++];
+}
+
+std::uint32_t RandomStream::uniform(std::uint32_t bound)
+{
+    // Multiply-shift, rejecting the few low products that would bias the result
+    auto product = static_cast<std::uint64_t>(next()) * bound;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < bound)
+    {
+        const std::uint32_t threshold = -bound % bound;
+        while (low < threshold)
+        {
+            product = static_cast<std::uint64_t>(next()) * bound;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+RandomStream::Block RandomStream::philox(Block counter, std::uint64_t key)
+{
+    auto key0 = static_cast<std::uint32_t>(key);
+    auto key1 = static_cast<std::uint32_t>(key >> 32);
+    for (int round = 0; round < PHILOX_ROUNDS; ++round)
+    {
+        const auto product0 = static_cast<std::uint64_t>(PHILOX_M0) * counter[0];
+        const auto product1 = static_cast<std::uint64_t>(PHILOX_M1) * counter[2];
+        counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key0,
+                   static_cast<std::uint32_t>(product1),
+                   static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key1,
+                   static_cast<std::uint32_t>(product0)};
+        key0 += PHILOX_W0;
+        key1 += PHILOX_W1;
+    }
+    return counter;
+}
+
+std::uint64_t RandomStream::mix(std::uint64_t first, std::uint64_t second)
+{
+    // SplitMix64 finalizer over the combined values
+    auto value = first ^ (second + 0x9E3779B97F4A7C15ULL + (first << 6) + (first >> 2));
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+std::uint64_t RandomStream::hash(std::string_view text)
+{
+    std::uint64_t value = 0xCBF29CE484222325ULL;
+    for (const auto character : text)
+    {
+        value ^= static_cast<unsigned char>(character);
+        value *= 0x100000001B3ULL;
+    }
+    return value;
+}
@@ -0,0 +1,17 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reportSink.hpp"
+#include "reportSinkText.hpp"
+#include <iostream>
+
+const std::shared_ptr<ReportSink>& ReportSink::standard()
+{
+    static const std::shared_ptr<ReportSink> sink = std::make_shared<ReportSinkText>(std::cout);
+    return sink;
+}
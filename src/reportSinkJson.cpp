@@ -0,0 +1,102 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reportSinkJson.hpp"
+#include <array>
+#include <charconv>
+#include <string>
+
+ReportSinkJson::ReportSinkJson(std::ostream& output, size_t bufferSize) : m_output(output), m_bufferSize(bufferSize)
+{
+    m_buffer.reserve(bufferSize);
+}
+
+ReportSinkJson::~ReportSinkJson()
+{
+    flush();
+}
+
+void ReportSinkJson::report(std::string_view event, std::string_view /*format*/,
+                            std::initializer_list<ReportField> fields)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffer += "{\"event\":";
+    quote(event);
+    for (const auto& field : fields)
+    {
+        m_buffer += ',';
+        quote(field.name);
+        m_buffer += ':';
+        if (const auto* text = std::get_if<std::string_view>(&field.value))
+        {
+            quote(*text);
+        }
+        else
+        {
+            std::array<char, 24> digits{};
+            const auto end = std::to_chars(digits.begin(), digits.end(), std::get<std::int64_t>(field.value)).ptr;
+            m_buffer.append(digits.begin(), end);
+        }
+    }
+    m_buffer += "}\n";
+
+    if (m_buffer.size() >= m_bufferSize)
+    {
+        m_output.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+void ReportSinkJson::flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_output.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_output.flush();
+    m_buffer.clear();
+}
+
+void ReportSinkJson::quote(std::string_view text)
+{
+    static constexpr std::array<char, 16> HEX{'0', '1', '2', '3', '4', '5', '6', '7',
+                                              '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+    m_buffer += '"';
+    size_t plain = 0;
+    for (size_t position = 0; position < text.size(); ++position)
+    {
+        const auto character = static_cast<unsigned char>(text[position]);
+        if (character >= 0x20 && character != '"' && character != '\\')
+        {
+            continue;
+        }
+
+        // Copy the characters needing no escape in one piece
+        m_buffer.append(text.substr(plain, position - plain));
+        plain = position + 1;
+        switch (character)
+        {
+        case '"':
+            m_buffer += "\\\"";
+            break;
+        case '\\':
+            m_buffer += "\\\\";
+            break;
+        case '\n':
+            m_buffer += "\\n";
+            break;
+        case '\t':
+            m_buffer += "\\t";
+            break;
+        default:
+            m_buffer += "\\u00";
+            m_buffer += HEX[character >> 4];
+            m_buffer += HEX[character & 0xF];
+        }
+    }
+    m_buffer.append(text.substr(plain));
+    m_buffer += '"';
+}
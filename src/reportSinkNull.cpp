@@ -0,0 +1,18 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reportSinkNull.hpp"
+
+void ReportSinkNull::report(std::string_view /*event*/, std::string_view /*format*/,
+                            std::initializer_list<ReportField> /*fields*/)
+{
+}
+
+void ReportSinkNull::flush()
+{
+}
@@ -0,0 +1,68 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reportSinkText.hpp"
+#include <array>
+#include <charconv>
+#include <string>
+
+ReportSinkText::ReportSinkText(std::ostream& output, size_t bufferSize) : m_output(output), m_bufferSize(bufferSize)
+{
+    m_buffer.reserve(bufferSize);
+}
+
+ReportSinkText::~ReportSinkText()
+{
+    flush();
+}
+
+void ReportSinkText::report(std::string_view /*event*/, std::string_view format,
+                            std::initializer_list<ReportField> fields)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto field = fields.begin();
+    for (size_t position = 0; position <= format.size();)
+    {
+        const auto placeholder = format.find("{}", position);
+        m_buffer.append(format.substr(position, placeholder - position));
+        if (placeholder == std::string_view::npos)
+        {
+            break;
+        }
+        if (field != fields.end())
+        {
+            if (const auto* text = std::get_if<std::string_view>(&field->value))
+            {
+                m_buffer.append(*text);
+            }
+            else
+            {
+                std::array<char, 24> digits{};
+                const auto end = std::to_chars(digits.begin(), digits.end(), std::get<std::int64_t>(field->value)).ptr;
+                m_buffer.append(digits.begin(), end);
+            }
+            ++field;
+        }
+        position = placeholder + 2;
+    }
+    m_buffer += '\n';
+
+    if (m_buffer.size() >= m_bufferSize)
+    {
+        m_output.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+void ReportSinkText::flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_output.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_output.flush();
+    m_buffer.clear();
+}
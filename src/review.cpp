@@ -7,9 +7,9 @@
  */
 
 #include "review.hpp"
-#include <iostream>
 
-Review::Review(const std::string& text, Rating rating) : m_text(text), m_rating(rating)
+Review::Review(const std::string& text, Rating rating, Confidence confidence)
+    : m_text(text), m_rating(rating), m_confidence(confidence)
 {
 }
 
@@ -28,7 +28,20 @@ void Review::rating(Rating rating)
     m_rating = rating;
 }
 
-void Review::printReview() const
+Confidence Review::confidence() const
 {
-    std::cout << m_text << "\tRating: " << static_cast<int>(m_rating) << std::endl;
+    return m_confidence;
+}
+
+void Review::confidence(Confidence confidence)
+{
+    m_confidence = confidence;
+}
+
+void Review::printReview(ReportSink& sink) const
+{
+    sink.report("review", "{}\tRating: {}\tConfidence: {}",
+                {{"text", m_text},
+                 {"rating", static_cast<std::int64_t>(m_rating)},
+                 {"confidence", static_cast<std::int64_t>(m_confidence)}});
 }
@@ -0,0 +1,102 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reviewAggregate.hpp"
+
+namespace
+{
+/**
+ * @brief Divide rounding towards positive infinity.
+ * @param numerator The dividend.
+ * @param denominator The divisor, which must be positive.
+ * @return The smallest integer not lower than numerator / denominator.
+ */
+std::int64_t ceilDivide(std::int64_t numerator, std::int64_t denominator)
+{
+    return numerator >= 0 ? (numerator + denominator - 1) / denominator : -(-numerator / denominator);
+}
+} // namespace
+
+void ReviewAggregate::add(const Review& review)
+{
+    add(review.rating(), review.confidence());
+}
+
+void ReviewAggregate::add(Rating rating, Confidence confidence)
+{
+    const auto value = static_cast<int>(rating);
+    const auto weight = static_cast<std::uint32_t>(confidence);
+
+    ++m_count;
+    m_weight += weight;
+    m_weightedSum += static_cast<std::int64_t>(value) * weight;
+
+    // Weighted Welford update
+    const auto delta = value - m_mean;
+    m_mean += delta * weight / m_weight;
+    m_squaredDeviations += weight * delta * (value - m_mean);
+
+    if (value < static_cast<int>(m_min))
+    {
+        m_min = rating;
+    }
+    if (value > static_cast<int>(m_max))
+    {
+        m_max = rating;
+    }
+}
+
+bool ReviewAggregate::empty() const
+{
+    return m_count == 0;
+}
+
+std::uint32_t ReviewAggregate::count() const
+{
+    return m_count;
+}
+
+std::uint32_t ReviewAggregate::weight() const
+{
+    return m_weight;
+}
+
+std::int64_t ReviewAggregate::weightedSum() const
+{
+    return m_weightedSum;
+}
+
+double ReviewAggregate::mean() const
+{
+    return m_mean;
+}
+
+double ReviewAggregate::variance() const
+{
+    return m_weight == 0 ? 0.0 : m_squaredDeviations / m_weight;
+}
+
+Rating ReviewAggregate::min() const
+{
+    return m_min;
+}
+
+Rating ReviewAggregate::max() const
+{
+    return m_max;
+}
+
+Rating ReviewAggregate::rating() const
+{
+    return m_weight == 0 ? Rating::Neutral : static_cast<Rating>(ceilDivide(m_weightedSum, m_weight));
+}
+
+std::int32_t ReviewAggregate::scoreKey() const
+{
+    return m_weight == 0 ? 0 : static_cast<std::int32_t>(ceilDivide(m_weightedSum * SCORE_SCALE, m_weight));
+}
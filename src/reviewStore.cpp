@@ -0,0 +1,117 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reviewStore.hpp"
+#include "randomStream.hpp"
+
+static_assert(sizeof(StoredReview) == 16, "Review records must stay compact");
+
+std::uint32_t ReviewStore::intern(std::string_view text)
+{
+    const auto id = static_cast<std::uint32_t>(m_offsets.size() - 1);
+    const auto [interned, added] = m_texts.try_emplace(RandomStream::hash(text), id);
+    if (!added && this->text(interned->second) == text)
+    {
+        return interned->second;
+    }
+
+    // A text colliding with another one is stored again, without being interned
+    m_arena.append(text);
+    m_offsets.push_back(static_cast<std::uint32_t>(m_arena.size()));
+    return id;
+}
+
+std::uint32_t ReviewStore::add(ReviewerId reviewer, ArticleId article, std::uint32_t text, Rating rating,
+                               Confidence confidence)
+{
+    const auto review = static_cast<std::uint32_t>(m_records.size());
+    m_records.push_back({reviewer, article, text, rating, confidence});
+    resize(article + size_t{1});
+    m_byArticle[article].push_back(review);
+    if (reviewer != NO_REVIEWER)
+    {
+        if (m_byReviewer.size() <= reviewer)
+        {
+            m_byReviewer.resize(reviewer + size_t{1});
+        }
+        m_byReviewer[reviewer].push_back(review);
+    }
+    return review;
+}
+
+std::uint32_t ReviewStore::add(ReviewerId reviewer, ArticleId article, const Review& review)
+{
+    return add(reviewer, article, intern(review.reviewText()), review.rating(), review.confidence());
+}
+
+void ReviewStore::resize(size_t articles)
+{
+    if (m_byArticle.size() < articles)
+    {
+        m_byArticle.resize(articles);
+    }
+}
+
+size_t ReviewStore::size() const
+{
+    return m_records.size();
+}
+
+bool ReviewStore::empty() const
+{
+    return m_records.empty();
+}
+
+size_t ReviewStore::articles() const
+{
+    return m_byArticle.size();
+}
+
+size_t ReviewStore::texts() const
+{
+    return m_offsets.size() - 1;
+}
+
+size_t ReviewStore::textBytes() const
+{
+    return m_arena.size();
+}
+
+const StoredReview& ReviewStore::operator[](std::uint32_t review) const
+{
+    return m_records[review];
+}
+
+std::string_view ReviewStore::text(std::uint32_t text) const
+{
+    return std::string_view(m_arena).substr(m_offsets[text], m_offsets[text + 1] - m_offsets[text]);
+}
+
+Review ReviewStore::review(std::uint32_t review) const
+{
+    const auto& record = m_records[review];
+    return {std::string(text(record.text)), record.rating, record.confidence};
+}
+
+std::span<const std::uint32_t> ReviewStore::articleReviews(ArticleId article) const
+{
+    if (article >= m_byArticle.size())
+    {
+        return {};
+    }
+    return m_byArticle[article];
+}
+
+std::span<const std::uint32_t> ReviewStore::reviewerReviews(ReviewerId reviewer) const
+{
+    if (reviewer >= m_byReviewer.size())
+    {
+        return {};
+    }
+    return m_byReviewer[reviewer];
+}
@@ -8,40 +8,161 @@
 
 #include "reviewer.hpp"
 #include <algorithm>
-#include <ctime>
-#include <random>
+#include <stdexcept>
+
+namespace
+{
+thread_local ReviewerBuffer* boundBuffer = nullptr; /**< The buffer recording the entries of this thread, if any. */
+thread_local std::string reviewText;                /**< The text of the last review stored from this thread. */
+constexpr double BID_DRAWS = 4294967296.0;          /**< The number of distinct 32-bit draws. */
+
+/**
+ * @brief Kinds of simulated decisions, each drawn from its own family of streams.
+ */
+enum class Decision : std::uint32_t
+{
+    Bid,             /**< A bid on a given article. */
+    Review,          /**< A review of a given article. */
+    SequentialBid,   /**< A bid drawn from the reviewer's own sequence. */
+    SequentialReview /**< A review drawn from the reviewer's own sequence. */
+};
+} // namespace
+
+Reviewer::Reviewer(const nlohmann::json& userJson) : User(userJson)
+{
+    if (userJson.contains("bidRate"))
+    {
+        m_bidRate = userJson.at("bidRate").get<double>();
+        if (!(*m_bidRate >= 0.0 && *m_bidRate <= 1.0))
+        {
+            throw std::invalid_argument("Bid rate out of range for reviewer: " + m_fullNames);
+        }
+    }
+}
+
+std::optional<double> Reviewer::bidRate() const
+{
+    return m_bidRate;
+}
 
 Bid Reviewer::determineInterest()
 {
-    static std::mt19937 gen(static_cast<unsigned int>(time(nullptr))); // Random number generator
-    static std::uniform_int_distribution<> dis(0, 3);                  // Distribution
+    RandomStream stream(streamKey(), m_events++, static_cast<std::uint32_t>(Decision::SequentialBid));
+    return placeBid(stream);
+}
 
-    int decision = dis(gen);
-    Bid bid;
-    if (decision == 0)
+Bid Reviewer::determineInterest(std::uint64_t event)
+{
+    RandomStream stream(streamKey(), event, static_cast<std::uint32_t>(Decision::Bid));
+    return placeBid(stream);
+}
+
+Review Reviewer::reviewArticle()
+{
+    RandomStream stream(streamKey(), m_events++, static_cast<std::uint32_t>(Decision::SequentialReview));
+    return writeReview(stream);
+}
+
+Review Reviewer::reviewArticle(std::uint64_t event)
+{
+    RandomStream stream(streamKey(), event, static_cast<std::uint32_t>(Decision::Review));
+    return writeReview(stream);
+}
+
+void Reviewer::determineInterest(std::uint64_t event, BidMatrix& bids, ReviewerId reviewer, ArticleId article)
+{
+    RandomStream stream(streamKey(), event, static_cast<std::uint32_t>(Decision::Bid));
+    bids.set(reviewer, article, drawInterest(stream));
+}
+
+Bid Reviewer::placeBid(RandomStream& stream)
+{
+    const Bid bid(m_fullNames, drawInterest(stream));
+    if (boundBuffer != nullptr)
     {
-        bid = Bid(m_fullNames, BiddingInterest::None); // No bid
+        boundBuffer->m_bids.emplace_back(this, bid);
     }
     else
     {
-        bid = Bid(m_fullNames, static_cast<BiddingInterest>(decision - 1)); // Adjusted for enum indexing
+        m_bids.push_back(bid);
     }
-    m_bids.push_back(bid);
     return bid;
 }
 
-Review Reviewer::reviewArticle()
+std::uint32_t Reviewer::reviewArticle(std::uint64_t event, ReviewStore& reviews, ReviewerId reviewer,
+                                      ArticleId article)
 {
-    static std::mt19937 gen(static_cast<unsigned int>(time(nullptr))); // Random number generator
-    static std::uniform_int_distribution<> dis(0, 6);                  // Distribution
-    auto message = "I, " + m_fullNames + ", have reviewed this article and consider that it is:";
+    RandomStream stream(streamKey(), event, static_cast<std::uint32_t>(Decision::Review));
+    const auto [rating, confidence] = drawReview(stream);
 
-    int decision = dis(gen);
-    auto review = std::make_shared<Review>(message, static_cast<Rating>(decision - 3));
-    m_reviews.push_back(review);
+    // The text is composed in a buffer of the thread, which keeps its capacity, and only reaches the store once
+    composeReviewText(reviewText);
+    return reviews.add(reviewer, article, reviews.intern(reviewText), rating, confidence);
+}
+
+Review Reviewer::writeReview(RandomStream& stream)
+{
+    std::string message;
+    composeReviewText(message);
+    const auto [rating, confidence] = drawReview(stream);
+    auto review = std::make_shared<Review>(message, rating, confidence);
+    if (boundBuffer != nullptr)
+    {
+        boundBuffer->m_reviews.emplace_back(this, review);
+    }
+    else
+    {
+        m_reviews.push_back(review);
+    }
     return *review;
 }
 
+BiddingInterest Reviewer::drawInterest(RandomStream& stream) const
+{
+    // Without a bid rate, the bid and its interest come from a single draw, as they always did
+    auto decision = 0U;
+    if (!m_bidRate)
+    {
+        decision = stream.uniform(4);
+    }
+    else if (stream.next() < *m_bidRate * BID_DRAWS)
+    {
+        decision = 2 + stream.uniform(3); // Any interest but None
+    }
+    if (decision == 0)
+    {
+        return BiddingInterest::None; // No bid
+    }
+    return static_cast<BiddingInterest>(decision - 1); // Adjusted for enum indexing
+}
+
+std::pair<Rating, Confidence> Reviewer::drawReview(RandomStream& stream)
+{
+    const auto decision = static_cast<int>(stream.uniform(7));
+    const auto confidence = static_cast<int>(stream.uniform(3)) + 1;
+    return {static_cast<Rating>(decision - 3), static_cast<Confidence>(confidence)};
+}
+
+void Reviewer::composeReviewText(std::string& text) const
+{
+    text.assign("I, ").append(m_fullNames).append(", have reviewed this article and consider that it is:");
+}
+
+std::uint64_t Reviewer::streamKey() const
+{
+    return RandomStream::mix(m_seed, RandomStream::hash(m_fullNames));
+}
+
+std::uint64_t Reviewer::seed() const
+{
+    return m_seed;
+}
+
+void Reviewer::seed(std::uint64_t seed)
+{
+    m_seed = seed;
+}
+
 void Reviewer::review(const std::shared_ptr<Review>& review, OperationType operation)
 {
     if (operation == OperationType::Create)
@@ -63,3 +184,32 @@ const std::vector<std::shared_ptr<Review>>& Reviewer::reviews() const
 {
     return m_reviews;
 }
+
+ReviewerBuffer::Scope::Scope(ReviewerBuffer& buffer) : m_previous(boundBuffer)
+{
+    boundBuffer = &buffer;
+}
+
+ReviewerBuffer::Scope::~Scope()
+{
+    boundBuffer = m_previous;
+}
+
+void ReviewerBuffer::merge()
+{
+    for (auto& [reviewer, bid] : m_bids)
+    {
+        reviewer->m_bids.push_back(std::move(bid));
+    }
+    for (auto& [reviewer, review] : m_reviews)
+    {
+        reviewer->m_reviews.push_back(std::move(review));
+    }
+    m_bids.clear();
+    m_reviews.clear();
+}
+
+bool ReviewerBuffer::empty() const
+{
+    return m_bids.empty() && m_reviews.empty();
+}
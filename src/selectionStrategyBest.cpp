@@ -7,13 +7,15 @@
  */
 
 #include "selectionStrategyBest.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 constexpr auto MINIMUN_THRESHOLD = -3;
 constexpr auto MAXIMUM_THRESHOLD = 3;
+constexpr auto RANKING_SHARE = 4; /**< Above one article in this many, scanning the scores beats sorting the ids. */
 
-void SelectionStrategyBest::select(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                                   const std::unordered_map<std::shared_ptr<Article>, Rating>& ratingMap,
-                                   int selectionThreshold)
+void SelectionStrategyBest::select(std::vector<ArticleId>& selectedArticles,
+                                   std::span<const ReviewAggregate> scores, int selectionThreshold)
 {
     if (selectionThreshold < MINIMUN_THRESHOLD || selectionThreshold > MAXIMUM_THRESHOLD)
     {
@@ -22,11 +24,32 @@ void SelectionStrategyBest::select(std::vector<std::shared_ptr<Article>>& select
 
     selectedArticles.clear(); // Clear any existing articles
 
-    for (const auto& pair : ratingMap)
+    for (ArticleId article = 0; article < scores.size(); ++article)
     {
-        if (static_cast<int>(pair.second) >= selectionThreshold)
+        if (!scores[article].empty() && static_cast<int>(scores[article].rating()) >= selectionThreshold)
         {
-            selectedArticles.push_back(pair.first);
+            selectedArticles.push_back(article);
         }
     }
 }
+
+void SelectionStrategyBest::select(std::vector<ArticleId>& selectedArticles, const Leaderboard& leaderboard,
+                                   int selectionThreshold)
+{
+    if (selectionThreshold < MINIMUN_THRESHOLD || selectionThreshold > MAXIMUM_THRESHOLD)
+    {
+        throw std::runtime_error("Selection threshold is not within the valid range of -3 to +3.");
+    }
+
+    // The rating is the score key divided by the scale and rounded up, so it reaches the threshold
+    // exactly when the score key exceeds the one of the rating below
+    const auto lowestKey = (selectionThreshold - 1) * ReviewAggregate::SCORE_SCALE + 1;
+    const auto selected = leaderboard.atOrAbove(lowestKey);
+    if (selected * RANKING_SHARE > leaderboard.size())
+    {
+        select(selectedArticles, leaderboard.scores(), selectionThreshold);
+        return;
+    }
+    leaderboard.top(selected, selectedArticles);
+    std::sort(selectedArticles.begin(), selectedArticles.end());
+}
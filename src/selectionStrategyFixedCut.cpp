@@ -8,41 +8,88 @@
 
 #include "selectionStrategyFixedCut.hpp"
 #include <algorithm>
-#include <iostream>
+#include <stdexcept>
 
 constexpr auto MIN_THRESHOLD_PERCENTAGE = 0;
 constexpr auto MAX_THRESHOLD_PERCENTAGE = 100;
+constexpr auto RANKING_SHARE = 4; /**< Above one article in this many, the counting pass beats walking the ranking. */
+namespace
+{
+/**
+ * @brief Map a score to its bucket, from 0 for the lowest score key to SCORE_LEVELS - 1 for the highest.
+ */
+size_t scoreLevel(const ReviewAggregate& score)
+{
+    constexpr auto lowestKey = static_cast<int>(Rating::NotRecommended) * ReviewAggregate::SCORE_SCALE;
+    return static_cast<size_t>(score.scoreKey() - lowestKey);
+}
+} // namespace
 
-void SelectionStrategyFixedCut::select(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                                       const std::unordered_map<std::shared_ptr<Article>, Rating>& ratingMap,
-                                       int selectionThreshold)
+void SelectionStrategyFixedCut::select(std::vector<ArticleId>& selectedArticles,
+                                       std::span<const ReviewAggregate> scores, int selectionThreshold)
 {
     if (selectionThreshold <= MIN_THRESHOLD_PERCENTAGE || selectionThreshold > MAX_THRESHOLD_PERCENTAGE)
     {
         throw std::out_of_range("Selection threshold must be between 1 and 100");
     }
 
-    int numberArticlesToTake = ratingMap.size() * selectionThreshold / MAX_THRESHOLD_PERCENTAGE;
-
-    // Create a vector of articles from the map
-    std::vector<std::shared_ptr<Article>> articles;
-    articles.reserve(ratingMap.size());
-    for (const auto& pair : ratingMap)
+    // Count the reviewed articles of each score. The counters live in the call, so one strategy can select for
+    // several tracks at once.
+    std::vector<size_t> counters(2 * SCORE_LEVELS, 0);
+    const std::span<size_t> quotas(counters.data(), SCORE_LEVELS);
+    const std::span<size_t> positions(counters.data() + SCORE_LEVELS, SCORE_LEVELS);
+    size_t reviewedArticles = 0;
+    for (const auto& score : scores)
     {
-        articles.push_back(pair.first);
+        if (!score.empty())
+        {
+            ++quotas[scoreLevel(score)];
+            ++reviewedArticles;
+        }
     }
 
-    // Custom comparator function to order the map based on rating
-    auto ratingComparator = [&](const std::shared_ptr<Article>& article1, const std::shared_ptr<Article>& article2) {
-        const Rating rating1 = ratingMap.at(article1);
-        const Rating rating2 = ratingMap.at(article2);
+    // Walk the scores from the best one, deciding how many articles each contributes and where they go
+    const size_t numberArticlesToTake = reviewedArticles * selectionThreshold / MAX_THRESHOLD_PERCENTAGE;
+    size_t taken = 0;
+    for (size_t level = SCORE_LEVELS; level-- > 0;)
+    {
+        positions[level] = taken;
+        quotas[level] = std::min(quotas[level], numberArticlesToTake - taken);
+        taken += quotas[level];
+    }
 
-        return static_cast<int>(rating1) > static_cast<int>(rating2); // Higher ratings come first
-    };
+    // Scatter the ids in ascending order, so ties within a score are broken by id
+    selectedArticles.resize(numberArticlesToTake);
+    for (ArticleId article = 0; article < scores.size() && taken > 0; ++article)
+    {
+        if (scores[article].empty())
+        {
+            continue;
+        }
+        const auto level = scoreLevel(scores[article]);
+        if (quotas[level] > 0)
+        {
+            selectedArticles[positions[level]++] = article;
+            --quotas[level];
+            --taken;
+        }
+    }
+}
 
-    // Sort the articles based on rating using the custom comparator
-    std::sort(articles.begin(), articles.end(), ratingComparator);
+void SelectionStrategyFixedCut::select(std::vector<ArticleId>& selectedArticles, const Leaderboard& leaderboard,
+                                       int selectionThreshold)
+{
+    if (selectionThreshold <= MIN_THRESHOLD_PERCENTAGE || selectionThreshold > MAX_THRESHOLD_PERCENTAGE)
+    {
+        throw std::out_of_range("Selection threshold must be between 1 and 100");
+    }
 
-    selectedArticles.clear(); // Clear any existing articles
-    selectedArticles.insert(selectedArticles.end(), articles.begin(), articles.begin() + numberArticlesToTake);
+    // The ranking already orders the articles by score, then by id
+    const size_t numberArticlesToTake = leaderboard.reviewed() * selectionThreshold / MAX_THRESHOLD_PERCENTAGE;
+    if (numberArticlesToTake * RANKING_SHARE > leaderboard.size())
+    {
+        select(selectedArticles, leaderboard.scores(), selectionThreshold);
+        return;
+    }
+    leaderboard.top(numberArticlesToTake, selectedArticles);
 }
@@ -0,0 +1,443 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "trackCore.hpp"
+#include "assignmentStrategyRoundRobin.hpp"
+#include "bid.hpp"
+#include "randomStream.hpp"
+#include "trackPoster.hpp"
+#include "trackRegular.hpp"
+#include "trackWorkshop.hpp"
+#include <algorithm>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace
+{
+constexpr std::string_view INVALID_ARTICLE = "Article is not valid for this track"; /**< Why an article is refused. */
+
+/** The label of each reason of a rejection in the metrics, by TrackError. */
+constexpr std::array<std::string_view, 6> ERROR_LABELS{"none",           "invalidArticle",   "wrongArticleType",
+                                                       "phaseClosed",    "duplicateArticle", "articleNotFound"};
+} // namespace
+
+template <typename Policy>
+TrackCore<Policy>::TrackCore(const nlohmann::json& trackData)
+{
+    m_trackName = trackData.value("trackTopic", "");
+    m_reportSink = ReportSink::standard();
+    m_assignmentStrategy = std::make_shared<AssignmentStrategyRoundRobin>();
+    m_conflictIndex = std::make_shared<ConflictIndex>();
+}
+
+template <typename Policy>
+TrackCore<Policy>::TrackCore(const std::string& trackName, const TrackPhase& state,
+                             const std::vector<std::shared_ptr<User>>& users)
+    : m_trackName(trackName), m_reviewers(users), m_currentState(state),
+      m_assignmentStrategy(std::make_shared<AssignmentStrategyRoundRobin>()), m_reportSink(ReportSink::standard()),
+      m_conflictIndex(std::make_shared<ConflictIndex>())
+{
+}
+
+template <typename Policy>
+bool TrackCore<Policy>::accepts(const Article& article)
+{
+    if constexpr (std::is_same_v<typename Policy::ArticleType, Article>)
+    {
+        return true;
+    }
+    else
+    {
+        // An exact type comparison, the articles are never derived further
+        return typeid(article) == typeid(typename Policy::ArticleType);
+    }
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::report(TrackResult result, const Article* article) const
+{
+    if constexpr (METRICS_ENABLED)
+    {
+        if (!result)
+        {
+            const auto error = static_cast<size_t>(result.error());
+            if (m_rejected[error] == nullptr)
+            {
+                const MetricLabels labels{{"track", m_trackName}, {"error", std::string(ERROR_LABELS[error])}};
+                m_rejected[error] = &Metrics::global().counter("comfychair_rejected_operations_total", labels);
+            }
+            m_rejected[error]->add();
+        }
+    }
+
+    switch (result.error())
+    {
+    case TrackError::None:
+        break;
+    case TrackError::InvalidArticle:
+    case TrackError::WrongArticleType:
+        m_reportSink->report("invalidArticle", result.message(),
+                             {{"track", m_trackName}, {"article", article->articleName()}});
+        break;
+    case TrackError::DuplicateArticle:
+        m_reportSink->report("articleExists", result.message(), {{"article", article->articleName()}});
+        break;
+    case TrackError::ArticleNotFound:
+        m_reportSink->report("articleNotFound", result.message(),
+                             {{"article", article != nullptr ? article->articleName() : std::string()}});
+        break;
+    case TrackError::PhaseClosed:
+        m_reportSink->report("trackError", "{}", {{"message", result.message()}, {"track", m_trackName}});
+        break;
+    }
+    return result;
+}
+
+template <typename Policy>
+std::uint64_t TrackCore<Policy>::trackKey() const
+{
+    return RandomStream::hash(m_trackName);
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::handleTrackArticle(const std::shared_ptr<Article>& article, OperationType operation)
+{
+    if (!article->isValid())
+    {
+        return report({TrackError::InvalidArticle, INVALID_ARTICLE}, article.get());
+    }
+    if (!accepts(*article))
+    {
+        return report({TrackError::WrongArticleType, INVALID_ARTICLE}, article.get());
+    }
+
+    // Recorded once applied, so the log only holds the operations replaying it applies again the same way
+    const auto result = m_currentState.handleArticle(m_articles, article, operation);
+    m_journal.article(*article, operation, result);
+    return report(result, article.get());
+}
+
+template <typename Policy>
+std::vector<TrackResult> TrackCore<Policy>::handleTrackArticles(std::span<const std::shared_ptr<Article>> articles,
+                                                                OperationType operation)
+{
+    std::vector<TrackResult> results(articles.size());
+    for (size_t article = 0; article < articles.size(); ++article)
+    {
+        if (!articles[article]->isValid())
+        {
+            results[article] = {TrackError::InvalidArticle, INVALID_ARTICLE};
+        }
+        else if (!accepts(*articles[article]))
+        {
+            results[article] = {TrackError::WrongArticleType, INVALID_ARTICLE};
+        }
+    }
+
+    // Recorded once applied, as handleTrackArticle does, so only the accepted articles reach the log
+    m_currentState.handleArticles(m_articles, articles, operation, results);
+    m_journal.articles(articles, results, operation);
+    for (size_t article = 0; article < articles.size(); ++article)
+    {
+        report(results[article], articles[article].get());
+    }
+    return results;
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::handleTrackBidding()
+{
+    // The bids the phase replaces are set aside, so the journal only records the cells that changed
+    BidMatrix previous;
+    std::swap(previous, m_bidMatrix);
+    const auto result = m_currentState.handleBidding(m_articles.articles(), trackKey(), m_bidMatrix, m_reviewers);
+    if (result)
+    {
+        m_journal.bids(previous, m_bidMatrix);
+    }
+    else
+    {
+        m_bidMatrix = std::move(previous);
+    }
+    return report(result);
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::handleTrackReview()
+{
+    if (m_assignmentStrategy == nullptr)
+    {
+        throw std::runtime_error("Assignment strategy is null");
+    }
+
+    // The transient containers of the phase share one arena, released at once when the phase returns
+    std::pmr::monotonic_buffer_resource arena;
+    const auto stored = static_cast<std::uint32_t>(m_reviews.size());
+    const auto result =
+        m_currentState.handleReview(m_articles.articles(), trackKey(), m_bidMatrix, m_assignmentStrategy,
+                                    *m_conflictIndex, m_reviews, m_articleScores, m_reviewers, *m_reportSink, arena);
+    if (result)
+    {
+        m_journal.reviews(m_reviews, stored);
+    }
+    return report(result);
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::submitReview(ArticleId article, const Review& review)
+{
+    const auto result = m_currentState.submitReview(m_articles.articles(), article, review, m_reviews,
+                                                    m_articleScores, *m_reportSink);
+    if (result)
+    {
+        m_journal.review(article, review);
+    }
+    return report(result);
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::handleTrackSelection(int threshold)
+{
+    if (m_selectionStrategy == nullptr)
+    {
+        throw std::runtime_error("Selection strategy is null");
+    }
+
+    const auto result = m_currentState.handleSelection(m_selectedIds, m_selectionStrategy, m_articleScores, threshold);
+    if (!result)
+    {
+        return report(result);
+    }
+
+    // Resolve the selected ids back to the articles exposed by the track
+    m_selectedArticles.clear();
+    m_selectedArticles.reserve(m_selectedIds.size());
+    for (const auto article : m_selectedIds)
+    {
+        m_selectedArticles.push_back(m_articles.articles()[article]);
+    }
+    return result;
+}
+
+template <typename Policy>
+const std::string& TrackCore<Policy>::trackName() const
+{
+    return m_trackName;
+}
+
+template <typename Policy>
+void TrackCore<Policy>::establishState(const TrackPhase& state)
+{
+    m_currentState = state;
+    m_journal.state(m_currentState.name());
+}
+
+template <typename Policy>
+void TrackCore<Policy>::currentState() const
+{
+    m_reportSink->report("trackState", Policy::STATE_FORMAT,
+                         {{"track", m_trackName}, {"state", m_currentState.name()}});
+}
+
+template <typename Policy>
+int TrackCore<Policy>::amountArticles() const
+{
+    return m_articles.size();
+}
+
+template <typename Policy>
+void TrackCore<Policy>::selectionStrategy(const std::shared_ptr<SelectionStrategy>& strategy)
+{
+    m_selectionStrategy = strategy;
+}
+
+template <typename Policy>
+void TrackCore<Policy>::assignmentStrategy(const std::shared_ptr<AssignmentStrategy>& strategy)
+{
+    m_assignmentStrategy = strategy;
+}
+
+template <typename Policy>
+const std::vector<std::shared_ptr<Article>>& TrackCore<Policy>::selectedArticles() const
+{
+    return m_selectedArticles;
+}
+
+template <typename Policy>
+size_t TrackCore<Policy>::amountBids() const
+{
+    return m_bidMatrix.reviewers() == 0 ? 0 : m_bidMatrix.articles();
+}
+
+template <typename Policy>
+void TrackCore<Policy>::addReviewer(const std::shared_ptr<User>& reviewer)
+{
+    m_reviewers.push_back(reviewer);
+}
+
+template <typename Policy>
+void TrackCore<Policy>::currentBids() const
+{
+    const auto& articles = m_articles.articles();
+    const auto bidArticles = std::min(m_bidMatrix.articles(), articles.size());
+    const auto bidReviewers = std::min(m_bidMatrix.reviewers(), m_reviewers.size());
+    for (size_t article = 0; article < bidArticles; ++article)
+    {
+        m_reportSink->report("articleBids", "The article '{}' has the following biddings:",
+                             {{"article", articles[article]->articleName()}});
+        for (size_t reviewer = 0; reviewer < bidReviewers; ++reviewer)
+        {
+            Bid(m_reviewers[reviewer]->fullNames(), m_bidMatrix.at(reviewer, article)).bidSummary(*m_reportSink);
+        }
+    }
+}
+
+template <typename Policy>
+size_t TrackCore<Policy>::amountReviews() const
+{
+    size_t reviewed = 0;
+    for (ArticleId article = 0; article < m_reviews.articles(); ++article)
+    {
+        reviewed += !m_reviews.articleReviews(article).empty();
+    }
+    return reviewed;
+}
+
+template <typename Policy>
+void TrackCore<Policy>::currentReviews() const
+{
+    const auto& articles = m_articles.articles();
+    for (ArticleId article = 0; article < m_reviews.articles(); ++article)
+    {
+        const auto reviews = m_reviews.articleReviews(article);
+        if (reviews.empty())
+        {
+            continue;
+        }
+        m_reportSink->report("articleReviews", "The article '{}' has the following reviews:",
+                             {{"article", articles[article]->articleName()}});
+        for (const auto review : reviews)
+        {
+            m_reviews.review(review).printReview(*m_reportSink);
+        }
+    }
+}
+
+template <typename Policy>
+const std::vector<std::shared_ptr<Article>>& TrackCore<Policy>::articles() const
+{
+    return m_articles.articles();
+}
+
+template <typename Policy>
+const std::vector<std::shared_ptr<User>>& TrackCore<Policy>::reviewers() const
+{
+    return m_reviewers;
+}
+
+template <typename Policy>
+const BidMatrix& TrackCore<Policy>::bidMatrix() const
+{
+    return m_bidMatrix;
+}
+
+template <typename Policy>
+const ReviewStore& TrackCore<Policy>::reviewStore() const
+{
+    return m_reviews;
+}
+
+template <typename Policy>
+const Leaderboard& TrackCore<Policy>::articleScores() const
+{
+    return m_articleScores;
+}
+
+template <typename Policy>
+const TrackPhase& TrackCore<Policy>::state() const
+{
+    return m_currentState;
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::restoreArticles(std::span<const std::shared_ptr<Article>> articles)
+{
+    m_articles.reserve(m_articles.size() + articles.size());
+    for (const auto& article : articles)
+    {
+        if (!accepts(*article))
+        {
+            return {TrackError::WrongArticleType, INVALID_ARTICLE};
+        }
+        if (!m_articles.insert(article))
+        {
+            return {TrackError::DuplicateArticle, "Article already exists"};
+        }
+    }
+    return {};
+}
+
+template <typename Policy>
+void TrackCore<Policy>::restoreResults(BidMatrix bids, ReviewStore reviews)
+{
+    m_bidMatrix = std::move(bids);
+    m_reviews = std::move(reviews);
+    m_articleScores.clear();
+    m_articleScores.resize(m_reviews.articles());
+    for (std::uint32_t review = 0; review < m_reviews.size(); ++review)
+    {
+        m_articleScores.add(m_reviews[review].article, m_reviews[review].rating, m_reviews[review].confidence);
+    }
+}
+
+template <typename Policy>
+void TrackCore<Policy>::restoreBids(BidMatrix bids)
+{
+    m_bidMatrix = std::move(bids);
+}
+
+template <typename Policy>
+TrackResult TrackCore<Policy>::restoreReview(ReviewerId reviewer, ArticleId article, const Review& review)
+{
+    const auto articles = m_articles.articles().size();
+    if (article >= articles)
+    {
+        return {TrackError::ArticleNotFound, "Article not found"};
+    }
+    if (m_reviews.articles() < articles)
+    {
+        m_reviews.resize(articles);
+        m_articleScores.resize(articles);
+    }
+    m_reviews.add(reviewer, article, review);
+    m_articleScores.add(article, review);
+    return {};
+}
+
+template <typename Policy>
+void TrackCore<Policy>::journal(const TrackJournal& journal)
+{
+    m_journal = journal;
+}
+
+template <typename Policy>
+void TrackCore<Policy>::reportSink(const std::shared_ptr<ReportSink>& sink)
+{
+    m_reportSink = sink;
+}
+
+template <typename Policy>
+void TrackCore<Policy>::conflictIndex(const std::shared_ptr<const ConflictIndex>& index)
+{
+    m_conflictIndex = index;
+}
+
+template class TrackCore<TrackRegularPolicy>;
+template class TrackCore<TrackWorkshopPolicy>;
+template class TrackCore<TrackPosterPolicy>;
@@ -0,0 +1,181 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "trackPhase.hpp"
+#include <array>
+
+namespace
+{
+const std::array<TrackPhase, 4> PHASES{ReceptionStateTrack{}, BiddingStateTrack{}, ReviewStateTrack{},
+                                       SelectionStateTrack{}}; /**< Every phase, in order. */
+
+static_assert(std::variant_size_v<TrackPhase::State> == PHASES.size(), "Every phase must be listed");
+} // namespace
+
+std::string_view TrackPhase::name() const
+{
+    return std::visit([](const auto& state) { return state.NAME; }, m_state);
+}
+
+std::size_t TrackPhase::index() const
+{
+    return m_state.index();
+}
+
+std::optional<TrackPhase> TrackPhase::named(std::string_view name)
+{
+    for (const auto& phase : PHASES)
+    {
+        if (phase.name() == name)
+        {
+            return phase;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<TrackPhase> TrackPhase::at(std::size_t index)
+{
+    if (index >= PHASES.size())
+    {
+        return std::nullopt;
+    }
+    return PHASES[index];
+}
+
+TrackResult TrackPhase::handleArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article,
+                                      OperationType operation) const
+{
+    return std::visit(
+        [&](const auto& state) -> TrackResult {
+            if constexpr (requires { state.handleArticle(articles, article, operation); })
+            {
+                return state.handleArticle(articles, article, operation);
+            }
+            else
+            {
+                return {TrackError::PhaseClosed, state.ARTICLE_REJECTION};
+            }
+        },
+        m_state);
+}
+
+void TrackPhase::handleArticles(ArticleIndex& articles, std::span<const std::shared_ptr<Article>> submissions,
+                                OperationType operation, std::span<TrackResult> results) const
+{
+    std::visit(
+        [&](const auto& state) {
+            if constexpr (requires { state.handleArticles(articles, submissions, operation, results); })
+            {
+                state.handleArticles(articles, submissions, operation, results);
+            }
+            else
+            {
+                for (auto& result : results)
+                {
+                    if (result)
+                    {
+                        result = {TrackError::PhaseClosed, state.ARTICLE_REJECTION};
+                    }
+                }
+            }
+        },
+        m_state);
+}
+
+TrackResult TrackPhase::handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
+                                      std::uint64_t trackKey,
+                                      BidMatrix& biddingMatrix,
+                                      const std::vector<std::shared_ptr<User>>& reviewers) const
+{
+    return std::visit(
+        [&](const auto& state) -> TrackResult {
+            if constexpr (requires { state.handleBidding(articles, trackKey, biddingMatrix, reviewers); })
+            {
+                state.handleBidding(articles, trackKey, biddingMatrix, reviewers);
+                return {};
+            }
+            else
+            {
+                return {TrackError::PhaseClosed, state.BIDDING_REJECTION};
+            }
+        },
+        m_state);
+}
+
+TrackResult TrackPhase::handleReview(const std::vector<std::shared_ptr<Article>>& articles,
+                                     std::uint64_t trackKey,
+                                     const BidMatrix& biddingMatrix,
+                                     const std::shared_ptr<AssignmentStrategy>& assignmentStrategy,
+                                     const ConflictIndex& conflicts,
+                                     ReviewStore& reviews,
+                                     Leaderboard& scores,
+                                     const std::vector<std::shared_ptr<User>>& reviewers,
+                                     ReportSink& sink,
+                                     std::pmr::memory_resource& arena) const
+{
+    return std::visit(
+        [&](const auto& state) -> TrackResult {
+            if constexpr (requires {
+                              state.handleReview(articles, trackKey, biddingMatrix, assignmentStrategy, conflicts,
+                                                 reviews, scores, reviewers, sink, arena);
+                          })
+            {
+                state.handleReview(articles, trackKey, biddingMatrix, assignmentStrategy, conflicts, reviews, scores,
+                                   reviewers, sink, arena);
+                return {};
+            }
+            else
+            {
+                return {TrackError::PhaseClosed, state.REVIEW_REJECTION};
+            }
+        },
+        m_state);
+}
+
+TrackResult TrackPhase::submitReview(const std::vector<std::shared_ptr<Article>>& articles,
+                                     ArticleId article,
+                                     const Review& review,
+                                     ReviewStore& reviews,
+                                     Leaderboard& scores,
+                                     ReportSink& sink) const
+{
+    return std::visit(
+        [&](const auto& state) -> TrackResult {
+            if constexpr (requires { state.submitReview(articles, article, review, reviews, scores, sink); })
+            {
+                return state.submitReview(articles, article, review, reviews, scores, sink);
+            }
+            else
+            {
+                return {TrackError::PhaseClosed, state.REVIEW_REJECTION};
+            }
+        },
+        m_state);
+}
+
+TrackResult TrackPhase::handleSelection(std::vector<ArticleId>& selectedArticles,
+                                        const std::shared_ptr<SelectionStrategy>& selectionStrategy,
+                                        const Leaderboard& scores,
+                                        int selectionThreshold) const
+{
+    return std::visit(
+        [&](const auto& state) -> TrackResult {
+            if constexpr (requires { state.handleSelection(selectedArticles, selectionStrategy, scores,
+                                                           selectionThreshold); })
+            {
+                state.handleSelection(selectedArticles, selectionStrategy, scores, selectionThreshold);
+                return {};
+            }
+            else
+            {
+                return {TrackError::PhaseClosed, state.SELECTION_REJECTION};
+            }
+        },
+        m_state);
+}
@@ -7,47 +7,21 @@
  */
 
 #include "trackStateBidding.hpp"
-#include "bid.hpp"
-#include <iostream>
-
-void BiddingStateTrack::handleArticle(std::vector<std::shared_ptr<Article>>& articles,
-                                      const std::shared_ptr<Article>& article, OperationType operation)
-{
-    throw TrackStateException("Cannot handle articles in Bidding state");
-}
-
-void BiddingStateTrack::handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                                        std::shared_ptr<SelectionStrategy> selectionStrategy,
-                                        std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                                        int selectionThreshold)
-{
-    throw TrackStateException("Cannot handle selection in Bidding state");
-}
+#include "randomStream.hpp"
 
 void BiddingStateTrack::handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                                      std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                                      const std::vector<std::shared_ptr<User>>& reviewers)
+                                      std::uint64_t trackKey,
+                                      BidMatrix& biddingMatrix,
+                                      const std::vector<std::shared_ptr<User>>& reviewers) const
 {
-    for (const auto& reviewer : reviewers)
+    biddingMatrix.reset(reviewers.size(), articles.size());
+    for (ArticleId article = 0; article < articles.size(); ++article)
     {
-        for (const auto& article : articles)
+        // Bids are keyed by the track and the article, so they do not depend on the order they are placed in
+        const auto event = RandomStream::mix(trackKey, RandomStream::hash(articles[article]->articleName()));
+        for (ReviewerId reviewer = 0; reviewer < reviewers.size(); ++reviewer)
         {
-            auto interest = reviewer->determineInterest();
-            biddingMap[article] = interest;
+            reviewers[reviewer]->determineInterest(event, biddingMatrix, reviewer, article);
         }
     }
 }
-
-void BiddingStateTrack::handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                                     const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                                     std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                                     std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                                     const std::vector<std::shared_ptr<User>>& reviewers)
-{
-    throw TrackStateException("Review is not allowed in bidding state");
-}
-
-const std::string& BiddingStateTrack::stateName()
-{
-    return m_stateName;
-}
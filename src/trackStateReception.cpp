@@ -8,85 +8,63 @@
 
 #include "trackStateReception.hpp"
 #include "bid.hpp"
-#include <algorithm>
-#include <iostream>
 
-void ReceptionStateTrack::handleArticle(std::vector<std::shared_ptr<Article>>& articles,
-                                        const std::shared_ptr<Article>& article, OperationType operation)
+namespace
+{
+constexpr TrackResult NOT_FOUND{TrackError::ArticleNotFound, "Article not found"}; /**< No article has the title. */
+} // namespace
+
+TrackResult ReceptionStateTrack::handleArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article,
+                                               OperationType operation) const
 {
     switch (operation)
     {
     case OperationType::Create:
-        articles.push_back(article);
-        break;
+        if (!articles.insert(article))
+        {
+            return {TrackError::DuplicateArticle, "Article already exists"};
+        }
+        return {};
     case OperationType::Update:
-        updateArticle(articles, article);
-        break;
+        return updateArticle(articles, article);
     case OperationType::Delete:
-        removeArticle(articles, article);
-        break;
+        return removeArticle(articles, article);
     }
+    return {};
 }
 
-const std::string& ReceptionStateTrack::stateName()
-{
-    return m_stateName;
-}
-
-void ReceptionStateTrack::updateArticle(std::vector<std::shared_ptr<Article>>& articles,
-                                        const std::shared_ptr<Article>& article)
+void ReceptionStateTrack::handleArticles(ArticleIndex& articles, std::span<const std::shared_ptr<Article>> submissions,
+                                         OperationType operation, std::span<TrackResult> results) const
 {
-    const auto& targetTitle = article->articleName();
-    auto it = std::find_if(articles.begin(), articles.end(), [&targetTitle](const std::shared_ptr<Article>& a) {
-        return a->articleName() == targetTitle;
-    });
-    if (it != articles.end())
+    if (operation == OperationType::Create)
     {
-        (*it)->updateFields(article);
+        articles.reserve(articles.size() + submissions.size());
     }
-    else
+    for (size_t submission = 0; submission < submissions.size(); ++submission)
     {
-        std::cout << "Article not found" << std::endl;
+        if (results[submission])
+        {
+            results[submission] = handleArticle(articles, submissions[submission], operation);
+        }
     }
 }
 
-void ReceptionStateTrack::removeArticle(std::vector<std::shared_ptr<Article>>& articles,
-                                        const std::shared_ptr<Article>& article)
+TrackResult ReceptionStateTrack::updateArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article)
 {
-    const auto& targetTitle = article->articleName();
-    auto it = std::find_if(articles.begin(), articles.end(), [&targetTitle](const std::shared_ptr<Article>& a) {
-        return a->articleName() == targetTitle;
-    });
-    if (it != articles.end())
-    {
-        articles.erase(it);
-    }
-    else
+    auto* current = articles.find(article->articleName());
+    if (current == nullptr)
     {
-        std::cout << "Article not found" << std::endl;
+        return NOT_FOUND;
     }
+    current->updateFields(article);
+    return {};
 }
 
-void ReceptionStateTrack::handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                                        std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                                        const std::vector<std::shared_ptr<User>>& reviewers)
+TrackResult ReceptionStateTrack::removeArticle(ArticleIndex& articles, const std::shared_ptr<Article>& article)
 {
-    throw TrackStateException("Bidding is not allowed in reception state");
-}
-
-void ReceptionStateTrack::handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                                          std::shared_ptr<SelectionStrategy> selectionStrategy,
-                                          std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                                          int selectionThreshold)
-{
-    throw TrackStateException("Cannot handle selection in Reception state");
-}
-
-void ReceptionStateTrack::handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                                       const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                                       std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                                       std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                                       const std::vector<std::shared_ptr<User>>& reviewers)
-{
-    throw TrackStateException("Review is not allowed in reception state");
+    if (!articles.erase(article->articleName()))
+    {
+        return NOT_FOUND;
+    }
+    return {};
 }
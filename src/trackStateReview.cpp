@@ -7,95 +7,144 @@
  */
 
 #include "trackStateReview.hpp"
+#include "randomStream.hpp"
 #include <algorithm>
-#include <cmath>
-#include <iostream>
-#include <numeric>
-#include <unordered_map>
+#include <span>
+#include <string>
 #include <vector>
 
-void ReviewStateTrack::handleArticle(std::vector<std::shared_ptr<Article>>& articles,
-                                     const std::shared_ptr<Article>& article, OperationType operation)
-{
-    throw TrackStateException("Cannot handle articles in review state");
-}
-
-void ReviewStateTrack::handleBidding(const std::vector<std::shared_ptr<Article>>& articles,
-                                     std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                                     const std::vector<std::shared_ptr<User>>& reviewers)
-{
-    throw TrackStateException("Bidding is not allowed in review state");
-}
-
-void ReviewStateTrack::handleSelection(std::vector<std::shared_ptr<Article>>& selectedArticles,
-                                       std::shared_ptr<SelectionStrategy> selectionStrategy,
-                                       std::unordered_map<std::shared_ptr<Article>, Rating> ratingMap,
-                                       int selectionThreshold)
-{
-    throw TrackStateException("Cannot handle selection in review state");
-}
-
 void ReviewStateTrack::handleReview(const std::vector<std::shared_ptr<Article>>& articles,
-                                    const std::unordered_map<std::shared_ptr<Article>, Bid>& biddingMap,
-                                    std::unordered_map<std::shared_ptr<Article>, std::vector<Review>>& reviewMap,
-                                    std::unordered_map<std::shared_ptr<Article>, Rating>& averageRatings,
-                                    const std::vector<std::shared_ptr<User>>& reviewers)
+                                    std::uint64_t trackKey,
+                                    const BidMatrix& biddingMatrix,
+                                    const std::shared_ptr<AssignmentStrategy>& assignmentStrategy,
+                                    const ConflictIndex& conflicts,
+                                    ReviewStore& reviews,
+                                    Leaderboard& scores,
+                                    const std::vector<std::shared_ptr<User>>& reviewers,
+                                    ReportSink& sink,
+                                    std::pmr::memory_resource& arena) const
 {
-    size_t numArticlesPerReviewer = std::max(3ul, articles.size() / reviewers.size());
-    size_t extraArticles = articles.size() % reviewers.size();
-
-    // Step 1: Distribute articles based on bids and reviewer capacity
-    std::unordered_map<std::shared_ptr<User>, std::vector<std::shared_ptr<Article>>> assignments;
-    for (const auto& reviewer : reviewers)
+    if (reviewers.empty())
     {
-        assignments[reviewer] = {}; // Initialize assignments for each reviewer
+        return;
     }
 
-    // Initialize assignments for each reviewer
-    std::vector<std::shared_ptr<Article>> sortedArticles(articles.begin(), articles.end());
-    std::sort(sortedArticles.begin(), sortedArticles.end(),
-              [&](const std::shared_ptr<Article>& a, const std::shared_ptr<Article>& b) {
-                  return biddingMap.at(a) > biddingMap.at(b); // Assuming Bid has an operator> comparing bid importance
-              });
+    // Step 1: Count the reviews each article holds against its quota. Only the articles still missing reviews are
+    // assigned, so a run with nothing left to review computes no assignment at all.
+    reviews.resize(articles.size());
+    scores.resize(articles.size());
+    const auto quota = std::min<size_t>(assignmentStrategy->reviewsPerArticle(), reviewers.size());
+    std::pmr::vector<ArticleId> open(&arena);
+    for (ArticleId article = 0; article < articles.size(); ++article)
+    {
+        if (reviews.articleReviews(article).size() < quota)
+        {
+            open.push_back(article);
+        }
+    }
+    if (open.empty())
+    {
+        return;
+    }
 
-    size_t currentReviewerIndex = 0;
-    for (const auto& article : sortedArticles)
+    // The open articles are assigned by their position among them, along with their bids and the reviews they hold.
+    // Without bids every pair is equally eligible.
+    const auto hasBids = biddingMatrix.articles() == articles.size() && biddingMatrix.reviewers() == reviewers.size();
+    const auto compact = open.size() != articles.size();
+    std::span<const std::shared_ptr<Article>> assigned = articles;
+    std::pmr::vector<std::shared_ptr<Article>> openArticles(&arena);
+    const BidMatrix* bids = &biddingMatrix;
+    BidMatrix openBids(&arena);
+    if (!hasBids || compact)
     {
-        assignments[reviewers[currentReviewerIndex]].push_back(article);
-        if (++currentReviewerIndex >= reviewers.size())
+        openBids.reset(reviewers.size(), open.size());
+        bids = &openBids;
+    }
+    std::pmr::vector<ReviewAssignment> reviewed(&arena);
+    for (ArticleId position = 0; position < open.size(); ++position)
+    {
+        const auto article = open[position];
+        if (compact)
+        {
+            openArticles.push_back(articles[article]);
+        }
+        if (hasBids && compact)
+        {
+            const auto articleBids = biddingMatrix.articleBids(article);
+            for (ReviewerId reviewer = 0; reviewer < articleBids.size(); ++reviewer)
+            {
+                openBids.set(reviewer, position, articleBids[reviewer]);
+            }
+        }
+        for (const auto review : reviews.articleReviews(article))
         {
-            currentReviewerIndex = 0;
+            reviewed.push_back({reviews[review].reviewer, position});
         }
     }
+    if (compact)
+    {
+        assigned = openArticles;
+    }
+
+    // Reviewers sharing the affiliation of an author are never offered the article
+    ConflictMask mask(&arena);
+    const auto masked = conflicts.mask(mask, assigned, reviewers);
+    if (masked > 0)
+    {
+        sink.report("conflictsMasked", "{} reviewer-article pairs masked as conflicts of interest",
+                    {{"pairs", static_cast<std::int64_t>(masked)}});
+    }
+
+    std::pmr::vector<ReviewAssignment> assignments(&arena);
+    assignmentStrategy->assign(assignments, *bids, mask, reviewed);
+
+    // Step 2: Collect the missing reviews, folding them into the article scores as they arrive
+    std::pmr::vector<std::uint8_t> received(open.size(), 0, &arena);
+    for (const auto& assignment : assignments)
+    {
+        const auto article = open[assignment.article];
+        const auto event = RandomStream::mix(trackKey, RandomStream::hash(articles[article]->articleName()));
+        const auto& review =
+            reviews[reviewers[assignment.reviewer]->reviewArticle(event, reviews, assignment.reviewer, article)];
+        scores.add(article, review.rating, review.confidence);
+        received[assignment.article] = 1;
+    }
 
-    // Assign articles and collect reviews
-    for (const auto& [reviewer, assignedArticles] : assignments)
+    // Report the final rating of each article reviewed by this run
+    for (ArticleId position = 0; position < open.size(); ++position)
     {
-        for (const auto& article : assignedArticles)
+        if (received[position] != 0)
         {
-            Review review = reviewer->reviewArticle();
-            reviewMap[article].push_back(review);
+            reportRating(*articles[open[position]], scores[open[position]], sink);
         }
     }
+}
 
-    // Calculate average ratings per article
-    for (const auto& [article, reviews] : reviewMap)
+TrackResult ReviewStateTrack::submitReview(const std::vector<std::shared_ptr<Article>>& articles,
+                                           ArticleId article,
+                                           const Review& review,
+                                           ReviewStore& reviews,
+                                           Leaderboard& scores,
+                                           ReportSink& sink) const
+{
+    if (article >= articles.size())
     {
-        double sumRatings = std::accumulate(reviews.begin(), reviews.end(), 0.0, [](double sum, const Review& review) {
-            return sum + static_cast<int>(review.rating());
-        });
-        averageRatings[article] = static_cast<Rating>(std::ceil(sumRatings / reviews.size()));
+        return {TrackError::ArticleNotFound, "Article not found"};
     }
 
-    // Optional: Display average ratings for debugging
-    for (const auto& [article, avgRating] : averageRatings)
+    // The tables are sized on the first review, whether it comes from the phase or from a reviewer
+    if (reviews.articles() < articles.size())
     {
-        std::cout << "Article '" << article->articleName() << "' has an average rating of "
-                  << static_cast<int>(avgRating) << std::endl;
+        reviews.resize(articles.size());
+        scores.resize(articles.size());
     }
+    reviews.add(ReviewStore::NO_REVIEWER, article, review);
+    reportRating(*articles[article], scores.add(article, review), sink);
+    return {};
 }
 
-const std::string& ReviewStateTrack::stateName()
+void ReviewStateTrack::reportRating(const Article& article, const ReviewAggregate& score, ReportSink& sink)
 {
-    return m_stateName;
+    sink.report("articleRating", "Article '{}' has an average rating of {}",
+                {{"article", article.articleName()}, {"rating", static_cast<std::int64_t>(score.rating())}});
 }
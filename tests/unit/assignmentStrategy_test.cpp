@@ -0,0 +1,386 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "assignmentStrategy_test.hpp"
+#include "articleRegular.hpp"
+#include "assignmentStrategyOptimal.hpp"
+#include "assignmentStrategyRoundRobin.hpp"
+#include "conflictIndex.hpp"
+#include "reviewStore.hpp"
+#include "reviewer.hpp"
+#include <algorithm>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Memory resource counting the blocks it takes from the heap.
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+  public:
+    size_t allocations{0}; /**< The number of blocks allocated so far. */
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+} // namespace
+
+void AssignmentStrategyTest::SetUp()
+{
+}
+
+void AssignmentStrategyTest::TearDown()
+{
+}
+
+unsigned AssignmentStrategyTest::totalAffinity(const BidMatrix& bids,
+                                               const std::pmr::vector<ReviewAssignment>& assignments)
+{
+    unsigned total = 0;
+    for (const auto& assignment : assignments)
+    {
+        total += AssignmentStrategyOptimal::affinity(bids.at(assignment.reviewer, assignment.article));
+    }
+    return total;
+}
+
+TEST_F(AssignmentStrategyTest, RoundRobin)
+{
+    BidMatrix bids;
+    bids.reset(3, 4);
+    bids.set(0, 2, BiddingInterest::Interested);
+    bids.set(1, 2, BiddingInterest::Interested);
+    bids.set(2, 3, BiddingInterest::Maybe);
+
+    // One review per article, most demanded article first
+    std::pmr::vector<ReviewAssignment> assignments;
+    AssignmentStrategyRoundRobin roundRobin;
+    roundRobin.assign(assignments, bids, noConflicts, {});
+    ASSERT_EQ(assignments.size(), 4);
+    EXPECT_EQ(assignments[0].article, 2);
+    EXPECT_EQ(assignments[0].reviewer, 0);
+    EXPECT_EQ(assignments[1].article, 3);
+    EXPECT_EQ(assignments[1].reviewer, 1);
+    EXPECT_EQ(assignments[3].reviewer, 0);
+
+    // Reviews per article are capped by the number of reviewers
+    AssignmentStrategyRoundRobin manyReviews(5);
+    manyReviews.assign(assignments, bids, noConflicts, {});
+    EXPECT_EQ(assignments.size(), 12);
+
+    // Nothing to assign without reviewers
+    bids.reset(0, 4);
+    roundRobin.assign(assignments, bids, noConflicts, {});
+    EXPECT_TRUE(assignments.empty());
+}
+
+TEST_F(AssignmentStrategyTest, OptimalPrefersInterest)
+{
+    // Round-robin would give each reviewer the article the other one wants
+    BidMatrix bids;
+    bids.reset(2, 2);
+    bids.set(0, 0, BiddingInterest::Maybe);
+    bids.set(0, 1, BiddingInterest::Interested);
+    bids.set(1, 0, BiddingInterest::Interested);
+    bids.set(1, 1, BiddingInterest::NotInterested);
+
+    std::pmr::vector<ReviewAssignment> assignments;
+    AssignmentStrategyOptimal optimal(1, 1);
+    optimal.assign(assignments, bids, noConflicts, {});
+    ASSERT_EQ(assignments.size(), 2);
+    EXPECT_EQ(assignments[0].article, 0);
+    EXPECT_EQ(assignments[0].reviewer, 1);
+    EXPECT_EQ(assignments[1].article, 1);
+    EXPECT_EQ(assignments[1].reviewer, 0);
+    EXPECT_EQ(totalAffinity(bids, assignments), 6);
+
+    // A capacity too small to cover every review yields the largest possible assignment
+    bids.reset(1, 3);
+    optimal.assign(assignments, bids, noConflicts, {});
+    EXPECT_EQ(assignments.size(), 1);
+}
+
+TEST_F(AssignmentStrategyTest, OptimalMatchesExhaustiveSearch)
+{
+    constexpr std::uint32_t reviewers = 4;
+    constexpr std::uint32_t articles = 4;
+    constexpr std::uint32_t quota = 2;
+    constexpr std::uint32_t capacity = 2;
+
+    // Every pair of distinct reviewers an article can get
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+    for (std::uint32_t first = 0; first < reviewers; ++first)
+    {
+        for (std::uint32_t second = first + 1; second < reviewers; ++second)
+        {
+            pairs.emplace_back(first, second);
+        }
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> interest(0, 3);
+    AssignmentStrategyOptimal optimal(quota, capacity);
+    for (int instance = 0; instance < 50; ++instance)
+    {
+        BidMatrix bids;
+        bids.reset(reviewers, articles);
+        for (std::uint32_t article = 0; article < articles; ++article)
+        {
+            for (std::uint32_t reviewer = 0; reviewer < reviewers; ++reviewer)
+            {
+                bids.set(reviewer, article, static_cast<BiddingInterest>(interest(generator)));
+            }
+        }
+
+        // Exhaustive search over every combination that respects the reviewer capacity
+        unsigned best = 0;
+        std::vector<size_t> choice(articles, 0);
+        while (true)
+        {
+            std::vector<std::uint32_t> load(reviewers, 0);
+            unsigned affinity = 0;
+            for (std::uint32_t article = 0; article < articles; ++article)
+            {
+                const auto [first, second] = pairs[choice[article]];
+                ++load[first];
+                ++load[second];
+                affinity += AssignmentStrategyOptimal::affinity(bids.at(first, article)) +
+                            AssignmentStrategyOptimal::affinity(bids.at(second, article));
+            }
+            if (std::all_of(load.begin(), load.end(), [](std::uint32_t count) { return count <= capacity; }))
+            {
+                best = std::max(best, affinity);
+            }
+
+            size_t digit = 0;
+            while (digit < articles && ++choice[digit] == pairs.size())
+            {
+                choice[digit++] = 0;
+            }
+            if (digit == articles)
+            {
+                break;
+            }
+        }
+
+        std::pmr::vector<ReviewAssignment> assignments;
+        optimal.assign(assignments, bids, noConflicts, {});
+        ASSERT_EQ(assignments.size(), articles * quota);
+        EXPECT_EQ(totalAffinity(bids, assignments), best);
+
+        // Every article gets its quota from distinct reviewers and no reviewer exceeds its capacity
+        std::set<std::pair<std::uint32_t, std::uint32_t>> unique;
+        std::vector<std::uint32_t> load(reviewers, 0);
+        std::vector<std::uint32_t> reviews(articles, 0);
+        for (const auto& assignment : assignments)
+        {
+            unique.emplace(assignment.reviewer, assignment.article);
+            ++load[assignment.reviewer];
+            ++reviews[assignment.article];
+        }
+        EXPECT_EQ(unique.size(), assignments.size());
+        EXPECT_TRUE(std::all_of(load.begin(), load.end(), [](std::uint32_t count) { return count <= capacity; }));
+        EXPECT_TRUE(std::all_of(reviews.begin(), reviews.end(), [](std::uint32_t count) { return count == quota; }));
+    }
+}
+
+TEST_F(AssignmentStrategyTest, OptimalBeatsRoundRobin)
+{
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> interest(0, 3);
+    BidMatrix bids;
+    bids.reset(30, 200);
+    for (std::uint32_t article = 0; article < 200; ++article)
+    {
+        for (std::uint32_t reviewer = 0; reviewer < 30; ++reviewer)
+        {
+            bids.set(reviewer, article, static_cast<BiddingInterest>(interest(generator)));
+        }
+    }
+
+    std::pmr::vector<ReviewAssignment> roundRobinAssignments;
+    AssignmentStrategyRoundRobin roundRobin(3);
+    roundRobin.assign(roundRobinAssignments, bids, noConflicts, {});
+
+    std::pmr::vector<ReviewAssignment> optimalAssignments;
+    AssignmentStrategyOptimal optimal(3);
+    optimal.assign(optimalAssignments, bids, noConflicts, {});
+
+    // Same amount of reviews, spread evenly, with a better total affinity
+    ASSERT_EQ(optimalAssignments.size(), roundRobinAssignments.size());
+    std::vector<std::uint32_t> load(30, 0);
+    for (const auto& assignment : optimalAssignments)
+    {
+        ++load[assignment.reviewer];
+    }
+    EXPECT_LE(*std::max_element(load.begin(), load.end()), 20);
+    EXPECT_GT(totalAffinity(bids, optimalAssignments), totalAffinity(bids, roundRobinAssignments));
+}
+
+TEST_F(AssignmentStrategyTest, ConflictsOfInterestAreMasked)
+{
+    // Two of the three reviewers share an affiliation, and one of them also writes articles
+    ConflictIndex index;
+    std::vector<std::shared_ptr<User>> reviewers;
+    for (const auto& [name, affiliation] : {std::pair{"Ana Diaz", "UNC"}, {"Bruno Paz", "UTN"}, {"Carla Ruiz", "UNC"}})
+    {
+        const nlohmann::json userJson = {{"name", name},       {"affiliation", affiliation}, {"email", "user@tyh.com"},
+                                         {"password", "1234"}, {"isChair", false},           {"isAuthor", false},
+                                         {"isReviewer", true}};
+        reviewers.push_back(std::make_shared<Reviewer>(userJson));
+        index.addUser(*reviewers.back());
+    }
+    for (const auto& [name, affiliation] : {std::pair{"Diego Sosa", "UNC"}, {"Elena Gil", "UBA"}})
+    {
+        index.addUser(User({{"name", name},
+                            {"affiliation", affiliation},
+                            {"email", "author@tyh.com"},
+                            {"password", "1234"},
+                            {"isChair", false},
+                            {"isAuthor", true},
+                            {"isReviewer", false}}));
+    }
+    EXPECT_EQ(index.size(), 5);
+
+    // A name is registered once: the same person again is accepted, another affiliation is rejected and ignored
+    const auto namesake = [](const char* affiliation) {
+        return User({{"name", "Bruno Paz"},
+                     {"affiliation", affiliation},
+                     {"email", "namesake@tyh.com"},
+                     {"password", "1234"},
+                     {"isChair", false},
+                     {"isAuthor", true},
+                     {"isReviewer", false}});
+    };
+    EXPECT_TRUE(index.addUser(namesake("UTN")));
+    EXPECT_FALSE(index.addUser(namesake("UNC")));
+    EXPECT_FALSE(index.addUser(namesake("Unknown")));
+    EXPECT_EQ(index.size(), 5);
+
+    // The colleagues of every author are masked, unregistered authors have no conflict
+    const std::vector<std::vector<std::string>> authors{
+        {"Diego Sosa"}, {"Elena Gil", "Unregistered"}, {"Bruno Paz"}, {"Diego Sosa", "Bruno Paz"}};
+    std::vector<std::shared_ptr<Article>> articles;
+    for (const auto& names : authors)
+    {
+        articles.push_back(std::make_shared<ArticleRegular>("Article", "https://bit.ly/example", names, "Abstract."));
+    }
+    ConflictMask mask;
+    EXPECT_EQ(index.mask(mask, articles, reviewers), 6);
+    EXPECT_TRUE(mask.conflicted(0, 0));
+    EXPECT_FALSE(mask.conflicted(1, 0));
+    EXPECT_TRUE(mask.conflicted(2, 0));
+    EXPECT_FALSE(mask.conflicted(0, 1));
+    EXPECT_TRUE(mask.conflicted(1, 2));
+
+    // Both strategies assign every other pair, and the fully conflicted article is left without reviewer
+    BidMatrix bids;
+    bids.reset(reviewers.size(), articles.size());
+    bids.set(0, 0, BiddingInterest::Interested);
+    AssignmentStrategyRoundRobin roundRobin;
+    AssignmentStrategyOptimal optimal(1);
+    for (auto* strategy : std::initializer_list<AssignmentStrategy*>{&roundRobin, &optimal})
+    {
+        std::pmr::vector<ReviewAssignment> assignments;
+        strategy->assign(assignments, bids, mask, {});
+        EXPECT_EQ(assignments.size(), 3);
+        for (const auto& assignment : assignments)
+        {
+            EXPECT_FALSE(mask.conflicted(assignment.reviewer, assignment.article));
+            EXPECT_NE(assignment.article, 3);
+        }
+    }
+}
+
+TEST_F(AssignmentStrategyTest, EarlierReviewsCountAgainstTheQuota)
+{
+    // Article 0 holds its two reviews, article 1 one of them, article 2 one from an unknown reviewer
+    BidMatrix bids;
+    bids.reset(3, 3);
+    bids.set(2, 1, BiddingInterest::Interested);
+    const std::vector<ReviewAssignment> reviewed{{0, 0}, {1, 0}, {2, 1}, {ReviewStore::NO_REVIEWER, 2}};
+
+    AssignmentStrategyRoundRobin roundRobin(2);
+    AssignmentStrategyOptimal optimal(2);
+    for (auto* strategy : std::initializer_list<AssignmentStrategy*>{&roundRobin, &optimal})
+    {
+        // Only the missing reviews are assigned, never to a reviewer who already reviewed the article
+        std::pmr::vector<ReviewAssignment> assignments;
+        strategy->assign(assignments, bids, noConflicts, reviewed);
+        ASSERT_EQ(assignments.size(), 2);
+        std::vector<std::uint32_t> perArticle(3, 0);
+        for (const auto& assignment : assignments)
+        {
+            ++perArticle[assignment.article];
+            EXPECT_FALSE(assignment.article == 1 && assignment.reviewer == 2);
+        }
+        EXPECT_EQ(perArticle, (std::vector<std::uint32_t>{0, 1, 1}));
+
+        // Nothing is left to assign once every article holds its quota
+        const std::vector<ReviewAssignment> full{{0, 0}, {1, 0}, {0, 1}, {2, 1}, {1, 2}, {2, 2}};
+        strategy->assign(assignments, bids, noConflicts, full);
+        EXPECT_TRUE(assignments.empty());
+    }
+}
+
+TEST_F(AssignmentStrategyTest, ScratchComesFromTheArena)
+{
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> interest(0, 3);
+    BidMatrix bids;
+    bids.reset(20, 100);
+    for (std::uint32_t article = 0; article < 100; ++article)
+    {
+        for (std::uint32_t reviewer = 0; reviewer < 20; ++reviewer)
+        {
+            bids.set(reviewer, article, static_cast<BiddingInterest>(interest(generator)));
+        }
+    }
+
+    AssignmentStrategyRoundRobin roundRobin(3);
+    AssignmentStrategyOptimal optimal(3);
+    for (auto* strategy : std::initializer_list<AssignmentStrategy*>{&roundRobin, &optimal})
+    {
+        std::pmr::vector<ReviewAssignment> expected;
+        strategy->assign(expected, bids, noConflicts, {});
+
+        // Without a default resource, any scratch container not built from the arena would throw
+        CountingResource heap;
+        std::pmr::monotonic_buffer_resource arena(&heap);
+        std::pmr::vector<ReviewAssignment> assignments(&arena);
+        const auto defaultResource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+        EXPECT_NO_THROW(strategy->assign(assignments, bids, noConflicts, {}));
+        std::pmr::set_default_resource(defaultResource);
+
+        EXPECT_GT(heap.allocations, 0);
+        ASSERT_EQ(assignments.size(), expected.size());
+        EXPECT_TRUE(std::equal(assignments.begin(), assignments.end(), expected.begin(),
+                               [](const ReviewAssignment& a, const ReviewAssignment& b) {
+                                   return a.reviewer == b.reviewer && a.article == b.article;
+                               }));
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef ASSIGNMENT_STRATEGY_TEST_HPP
+#define ASSIGNMENT_STRATEGY_TEST_HPP
+
+#include "assignmentStrategy.hpp"
+#include "bidMatrix.hpp"
+#include "conflictMask.hpp"
+#include "gtest/gtest.h"
+#include <vector>
+
+/**
+ * @brief Runs unit tests for the assignment strategies.
+ *
+ */
+class AssignmentStrategyTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    AssignmentStrategyTest() = default;
+    ~AssignmentStrategyTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+
+    /**
+     * @brief Sum the affinity of every assigned pair.
+     * @param bids The bids the assignment was computed from.
+     * @param assignments The assignments to score.
+     * @return The total affinity of the assignment.
+     */
+    static unsigned totalAffinity(const BidMatrix& bids, const std::pmr::vector<ReviewAssignment>& assignments);
+
+    const ConflictMask noConflicts; /**< An empty mask, for the assignments without conflicts of interest. */
+};
+
+#endif // ASSIGNMENT_STRATEGY_TEST_HPP
@@ -0,0 +1,182 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conferenceLoader_test.hpp"
+#include "conferenceGenerator.hpp"
+#include "conferenceLoader.hpp"
+#include "reviewer.hpp"
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+const char* const CONFERENCE_DOCUMENT = R"(
+{
+    "createdAt": "2024-07-18T00:00:00Z",
+    "seed": 42,
+    "users": [
+        {
+            "name": "John Doe",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "john.doe@example.com",
+            "isChair": true,
+            "isReviewer": true,
+            "isAuthor": false
+        },
+        {
+            "name": "Jane Smith",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "jane.smith@example.com",
+            "isChair": false,
+            "isReviewer": false,
+            "isAuthor": true
+        }
+    ],
+    "tracks": [
+        {
+            "trackType": "regular",
+            "trackTopic": "C++",
+            "reviewers": ["John Doe"],
+            "articles": [
+                {
+                    "articleType": "regular",
+                    "articleTitle": "Advanced C++ Techniques",
+                    "attachedFileUrl": "https://bit.ly/example",
+                    "abstract": "Detailed exploration of modern C++ features.",
+                    "authors": ["Jane Smith"]
+                },
+                {
+                    "articleType": "regular",
+                    "articleTitle": "Modern C++ Concurrency",
+                    "attachedFileUrl": "https://bit.ly/example",
+                    "abstract": "Threads, atomics and memory models.",
+                    "authors": ["Jane Smith"]
+                }
+            ]
+        },
+        {
+            "articles": [
+                {
+                    "articleType": "poster",
+                    "articleTitle": "Visualizing Big Data",
+                    "attachedFileUrl": "https://bit.ly/example",
+                    "additionalFileUrl": "https://bit.ly/example2",
+                    "authors": ["Jane Smith"]
+                }
+            ],
+            "trackType": "poster",
+            "trackTopic": "Data Visualization",
+            "reviewers": ["John Doe"]
+        }
+    ]
+}
+)";
+} // namespace
+
+void ConferenceLoaderTest::SetUp()
+{
+}
+
+void ConferenceLoaderTest::TearDown()
+{
+}
+
+TEST_F(ConferenceLoaderTest, LoadsLikeTheConstructor)
+{
+    std::istringstream input(CONFERENCE_DOCUMENT);
+    const auto conference = ConferenceLoader::load(input);
+    Conference reference(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+
+    EXPECT_EQ(conference->sizeParticipants(), reference.sizeParticipants());
+    EXPECT_EQ(conference->seed(), 42);
+    ASSERT_EQ(conference->tracks().size(), reference.tracks().size());
+
+    // The loader also submits the articles, even those listed before the type of their track
+    EXPECT_EQ(conference->tracks().at(0)->amountArticles(), 2);
+    EXPECT_EQ(conference->tracks().at(1)->amountArticles(), 1);
+}
+
+TEST_F(ConferenceLoaderTest, ReportsInvalidTracks)
+{
+    std::istringstream input(R"(
+    {
+        "users": [],
+        "tracks": [
+            { "trackType": "keynote", "trackTopic": "Unknown" },
+            {
+                "trackType": "regular",
+                "trackTopic": "C++",
+                "articles": [
+                    {
+                        "articleType": "regular",
+                        "articleTitle": "Advanced C++ Techniques",
+                        "attachedFileUrl": "https://bit.ly/example",
+                        "abstract": "Detailed exploration of modern C++ features.",
+                        "authors": ["Jane Smith"]
+                    }
+                ],
+                "reviewers": ["Nobody"]
+            },
+            { "trackType": "workshop", "trackTopic": "Data Science" }
+        ]
+    }
+    )");
+
+    testing::internal::CaptureStdout();
+    const auto conference = ConferenceLoader::load(input);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(output.find("Error creating track: Unknown track type: keynote"), std::string::npos);
+    EXPECT_NE(output.find("Error creating track: Reviewer not found: Nobody"), std::string::npos);
+    ASSERT_EQ(conference->tracks().size(), 1);
+    EXPECT_EQ(conference->tracks().front()->amountArticles(), 0);
+}
+
+TEST_F(ConferenceLoaderTest, RejectsInvalidDocuments)
+{
+    std::istringstream truncated(R"({ "users": [ { "name": "John Doe" )");
+    EXPECT_THROW(ConferenceLoader::load(truncated), std::invalid_argument);
+
+    std::istringstream notAnObject(R"([ 1, 2, 3 ])");
+    EXPECT_THROW(ConferenceLoader::load(notAnObject), std::invalid_argument);
+
+    EXPECT_THROW(ConferenceLoader::load(std::string("/nonexistent/conference.json")), std::invalid_argument);
+}
+
+TEST_F(ConferenceLoaderTest, LoadsGeneratedConferences)
+{
+    const ConferenceGenerator generator(
+        {.tracks = 3, .articles = 40, .reviewers = 12, .reviewersPerTrack = 5, .authors = 50, .bidSkew = 2.0});
+    std::stringstream document;
+    generator.write(document);
+
+    // The document loads into the conference built in memory, articles included
+    const auto conference = ConferenceLoader::load(document);
+    const auto reference = generator.conference();
+    generator.submit(*reference);
+    EXPECT_EQ(conference->sizeParticipants(), reference->sizeParticipants());
+    ASSERT_EQ(conference->tracks().size(), 3);
+    for (size_t track = 0; track < 3; ++track)
+    {
+        ASSERT_EQ(conference->tracks()[track]->amountArticles(), 40);
+        ASSERT_EQ(conference->tracks()[track]->reviewers().size(), 5);
+        for (size_t article = 0; article < 40; ++article)
+        {
+            EXPECT_EQ(conference->tracks()[track]->articles()[article]->authors(),
+                      reference->tracks()[track]->articles()[article]->authors());
+        }
+    }
+
+    // Skewed reviewers bid on a share of the articles of their own
+    const auto& reviewer = static_cast<const Reviewer&>(*conference->tracks()[0]->reviewers()[0]);
+    ASSERT_TRUE(reviewer.bidRate().has_value());
+    EXPECT_GE(*reviewer.bidRate(), 0.0);
+    EXPECT_LT(*reviewer.bidRate(), 1.0);
+}
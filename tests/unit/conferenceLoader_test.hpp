@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFERENCE_LOADER_TEST_HPP
+#define CONFERENCE_LOADER_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "conferenceLoader.hpp"
+
+/**
+ * @brief Runs unit tests for ConferenceLoader.
+ *
+ */
+class ConferenceLoaderTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    ConferenceLoaderTest() = default;
+    ~ConferenceLoaderTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // CONFERENCE_LOADER_TEST_HPP
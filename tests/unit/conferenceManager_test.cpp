@@ -8,6 +8,119 @@
 
 #include "conferenceManager_test.hpp"
 #include "conferenceManager.hpp"
+#include "articleRegular.hpp"
+#include "metrics.hpp"
+#include "reviewer.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+/**
+ * @brief Build a conference whose tracks all share the same reviewers.
+ * @param tracks The number of tracks.
+ * @param articles The number of articles submitted to each track.
+ * @param reviewers The reviewers added to every track.
+ * @return The conference, with every track still in the reception state.
+ */
+std::shared_ptr<Conference> makeSharedConference(size_t tracks, size_t articles,
+                                                 const std::vector<std::shared_ptr<Reviewer>>& reviewers)
+{
+    nlohmann::json conferenceJson = {{"createdAt", "2024-07-18T00:00:00Z"}, {"tracks", nlohmann::json::array()}};
+    for (size_t track = 0; track < tracks; ++track)
+    {
+        conferenceJson["tracks"].push_back(
+            {{"trackType", "regular"}, {"trackTopic", "Topic " + std::to_string(track)}});
+    }
+
+    auto conference = std::make_shared<Conference>(conferenceJson);
+    for (const auto& track : conference->tracks())
+    {
+        for (const auto& reviewer : reviewers)
+        {
+            track->addReviewer(reviewer);
+        }
+        for (size_t article = 0; article < articles; ++article)
+        {
+            nlohmann::json articleJson = {{"articleTitle", "Article " + std::to_string(article)},
+                                          {"attachedFileUrl", "https://bit.ly/example"},
+                                          {"abstract", "Detailed exploration of modern C++ features."}};
+            track->handleTrackArticle(std::make_shared<ArticleRegular>(articleJson), OperationType::Create);
+        }
+    }
+    return conference;
+}
+
+/**
+ * @brief Collect the reviews a reviewer wrote in the review phases of a conference.
+ * @param conference The conference.
+ * @param reviewer The reviewer.
+ * @return The reviews of the reviewer, track by track, in the order they were written in each track.
+ */
+std::vector<Review> phaseReviews(const Conference& conference, const Reviewer& reviewer)
+{
+    std::vector<Review> reviews;
+    for (const auto& track : conference.tracks())
+    {
+        const auto& trackReviewers = track->reviewers();
+        for (ReviewerId id = 0; id < trackReviewers.size(); ++id)
+        {
+            if (trackReviewers[id].get() == &reviewer)
+            {
+                for (const auto review : track->reviewStore().reviewerReviews(id))
+                {
+                    reviews.push_back(track->reviewStore().review(review));
+                }
+            }
+        }
+    }
+    return reviews;
+}
+
+/**
+ * @brief Collect the bids of a reviewer from the bid matrices of a conference.
+ * @param conference The conference.
+ * @param reviewer The reviewer.
+ * @return The interest of the reviewer in each article, track by track, read from its row of each matrix.
+ */
+std::vector<BiddingInterest> phaseBids(const Conference& conference, const Reviewer& reviewer)
+{
+    std::vector<BiddingInterest> bids;
+    for (const auto& track : conference.tracks())
+    {
+        const auto& trackReviewers = track->reviewers();
+        const auto& matrix = track->bidMatrix();
+        for (ReviewerId id = 0; id < trackReviewers.size() && id < matrix.reviewers(); ++id)
+        {
+            if (trackReviewers[id].get() == &reviewer)
+            {
+                for (size_t article = 0; article < matrix.articles(); ++article)
+                {
+                    bids.push_back(matrix.at(id, article));
+                }
+            }
+        }
+    }
+    return bids;
+}
+
+/**
+ * @brief Create a reviewer.
+ * @param name The full name of the reviewer.
+ * @return The reviewer.
+ */
+std::shared_ptr<Reviewer> makeReviewer(const std::string& name)
+{
+    return std::make_shared<Reviewer>(nlohmann::json{{"name", name},
+                                                     {"affiliation", "Example University"},
+                                                     {"email", "reviewer@example.com"},
+                                                     {"password", "password"},
+                                                     {"isChair", false},
+                                                     {"isAuthor", false},
+                                                     {"isReviewer", true}});
+}
+} // namespace
 
 void ConferenceManagerTest::SetUp()
 {
@@ -132,3 +245,146 @@ TEST_F(ConferenceManagerTest, ConferenceCreation)
     conferenceManager->startRevision(std::chrono::system_clock::now());
     conferenceManager->startSelection(std::chrono::system_clock::now());
 }
+
+TEST_F(ConferenceManagerTest, ParallelPhasesShareReviewers)
+{
+    const std::vector<std::shared_ptr<Reviewer>> reviewers{makeReviewer("John Doe"), makeReviewer("Jane Doe")};
+    auto conference = makeSharedConference(8, 5, reviewers);
+    ConferenceManager conferenceManager(conference, 4);
+
+    conferenceManager.startBidding(std::chrono::system_clock::now());
+    conferenceManager.runBidding();
+    for (const auto& track : conference->tracks())
+    {
+        EXPECT_EQ(track->amountBids(), 5);
+        EXPECT_EQ(track->bidMatrix().size(), 10);
+    }
+    for (const auto& reviewer : reviewers)
+    {
+        EXPECT_TRUE(reviewer->bids().empty());
+        EXPECT_EQ(phaseBids(*conference, *reviewer).size(), 40);
+    }
+
+    conferenceManager.startRevision(std::chrono::system_clock::now());
+    testing::internal::CaptureStdout();
+    conferenceManager.runReview();
+    const auto output = testing::internal::GetCapturedStdout();
+
+    size_t reviewed = 0;
+    size_t reviews = 0;
+    for (const auto& track : conference->tracks())
+    {
+        EXPECT_EQ(track->amountReviews(), 5);
+        reviewed += track->amountReviews();
+        reviews += track->reviewStore().size();
+    }
+    EXPECT_EQ(phaseReviews(*conference, *reviewers[0]).size() + phaseReviews(*conference, *reviewers[1]).size(),
+              reviews);
+
+    // The tracks report concurrently, but every line must come out whole
+    std::istringstream lines(output);
+    size_t reported = 0;
+    for (std::string line; std::getline(lines, line); ++reported)
+    {
+        EXPECT_EQ(line.rfind("Article '", 0), 0);
+        EXPECT_NE(line.find("' has an average rating of "), std::string::npos);
+    }
+    EXPECT_EQ(reported, reviewed);
+}
+
+TEST_F(ConferenceManagerTest, ParallelPhaseRethrowsTrackErrors)
+{
+    const std::vector<std::shared_ptr<Reviewer>> reviewers{makeReviewer("John Doe")};
+    auto conference = makeSharedConference(4, 3, reviewers);
+    ConferenceManager conferenceManager(conference, 4);
+
+    conferenceManager.startBidding(std::chrono::system_clock::now());
+    conferenceManager.runBidding();
+    conferenceManager.startRevision(std::chrono::system_clock::now());
+    conference->tracks().at(2)->assignmentStrategy(nullptr);
+
+    testing::internal::CaptureStdout();
+    EXPECT_THROW(conferenceManager.runReview(), std::runtime_error);
+    testing::internal::GetCapturedStdout();
+
+    // The other tracks still ran, and their reviews are listed under the reviewer
+    EXPECT_EQ(conference->tracks().at(2)->amountReviews(), 0);
+    EXPECT_EQ(phaseReviews(*conference, *reviewers[0]).size(), 9);
+}
+
+TEST_F(ConferenceManagerTest, SeededRunsMatchAcrossThreads)
+{
+    // Run the same seeded conference with a single thread and with several
+    const auto simulate = [](size_t threads) {
+        const std::vector<std::shared_ptr<Reviewer>> reviewers{makeReviewer("John Doe"), makeReviewer("Jane Doe")};
+        for (const auto& reviewer : reviewers)
+        {
+            reviewer->seed(2024);
+        }
+        auto conference = makeSharedConference(6, 8, reviewers);
+        ConferenceManager conferenceManager(conference, threads);
+
+        testing::internal::CaptureStdout();
+        conferenceManager.startBidding(std::chrono::system_clock::now());
+        conferenceManager.runBidding();
+        conferenceManager.startRevision(std::chrono::system_clock::now());
+        conferenceManager.runReview();
+        testing::internal::GetCapturedStdout();
+
+        std::vector<int> decisions;
+        for (const auto& reviewer : reviewers)
+        {
+            for (const auto interest : phaseBids(*conference, *reviewer))
+            {
+                decisions.push_back(static_cast<int>(interest));
+            }
+            for (const auto& review : phaseReviews(*conference, *reviewer))
+            {
+                decisions.push_back(static_cast<int>(review.rating()));
+                decisions.push_back(static_cast<int>(review.confidence()));
+            }
+        }
+        return decisions;
+    };
+
+    const auto serial = simulate(1);
+    EXPECT_EQ(serial.size(), 2 * 48 + 2 * 48);
+    EXPECT_EQ(simulate(4), serial);
+}
+
+TEST_F(ConferenceManagerTest, PhasesAreMeasured)
+{
+    if constexpr (!METRICS_ENABLED)
+    {
+        GTEST_SKIP() << "The metrics are compiled out";
+    }
+
+    const std::vector<std::shared_ptr<Reviewer>> reviewers{makeReviewer("John Doe"), makeReviewer("Jane Doe")};
+    auto conference = makeSharedConference(3, 4, reviewers);
+    ConferenceManager conferenceManager(conference, 2);
+    auto& metrics = Metrics::global();
+    metrics.reset();
+
+    testing::internal::CaptureStdout();
+    conferenceManager.startBidding(std::chrono::system_clock::now());
+    conferenceManager.runBidding();
+    conferenceManager.startRevision(std::chrono::system_clock::now());
+    conferenceManager.runReview();
+    conference->tracks().front()->handleTrackBidding();
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(metrics.histogram("comfychair_phase_transition_seconds", {{"phase", "bidding"}}).count(), 1);
+    EXPECT_EQ(metrics.histogram("comfychair_phase_seconds", {{"phase", "review"}}).count(), 1);
+    for (const auto& track : conference->tracks())
+    {
+        const MetricLabels labels{{"track", track->trackName()}, {"phase", "bidding"}};
+        EXPECT_EQ(metrics.histogram("comfychair_track_phase_seconds", labels).count(), 1);
+        EXPECT_EQ(metrics.counter("comfychair_articles_processed_total", labels).value(), 4);
+        EXPECT_EQ(metrics.counter("comfychair_bids_total", {{"track", track->trackName()}}).value(), 8);
+        EXPECT_EQ(metrics.counter("comfychair_reviews_total", {{"track", track->trackName()}}).value(), 4);
+    }
+
+    // The late bidding request was rejected by the track in review
+    const MetricLabels rejected{{"track", conference->tracks().front()->trackName()}, {"error", "phaseClosed"}};
+    EXPECT_EQ(metrics.counter("comfychair_rejected_operations_total", rejected).value(), 1);
+}
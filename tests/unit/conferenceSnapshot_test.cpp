@@ -0,0 +1,234 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "conferenceSnapshot_test.hpp"
+#include "conferenceLoader.hpp"
+#include "conferenceManager.hpp"
+#include "conferenceSnapshot.hpp"
+#include "reviewer.hpp"
+#include "trackPhase.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+const char* const CONFERENCE_DOCUMENT = R"(
+{
+    "createdAt": "2024-07-18T00:00:00Z",
+    "seed": 7,
+    "users": [
+        {
+            "name": "John Doe",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "john.doe@example.com",
+            "isChair": true,
+            "isReviewer": true,
+            "isAuthor": false
+        },
+        {
+            "name": "Alice Brown",
+            "affiliation": "Example Institute",
+            "password": "secret",
+            "email": "alice.brown@example.com",
+            "isChair": false,
+            "isReviewer": true,
+            "isAuthor": false
+        },
+        {
+            "name": "Jane Smith",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "jane.smith@example.com",
+            "isChair": false,
+            "isReviewer": false,
+            "isAuthor": true
+        }
+    ],
+    "tracks": [
+        {
+            "trackType": "regular",
+            "trackTopic": "C++",
+            "reviewers": ["John Doe", "Alice Brown"],
+            "articles": [
+                {
+                    "articleType": "regular",
+                    "articleTitle": "Advanced C++ Techniques",
+                    "attachedFileUrl": "https://bit.ly/example",
+                    "abstract": "Detailed exploration of modern C++ features.",
+                    "authors": ["Jane Smith", "John Doe"]
+                },
+                {
+                    "articleType": "regular",
+                    "articleTitle": "Modern C++ Concurrency",
+                    "attachedFileUrl": "https://bit.ly/example",
+                    "abstract": "Threads, atomics and memory models.",
+                    "authors": ["Jane Smith"]
+                }
+            ]
+        },
+        {
+            "trackType": "poster",
+            "trackTopic": "Data Visualization",
+            "reviewers": ["Alice Brown"],
+            "articles": [
+                {
+                    "articleType": "poster",
+                    "articleTitle": "Visualizing Big Data",
+                    "attachedFileUrl": "https://bit.ly/example",
+                    "additionalFileUrl": "https://bit.ly/example2",
+                    "authors": ["Jane Smith"]
+                }
+            ]
+        },
+        { "trackType": "workshop", "trackTopic": "Data Science", "reviewers": ["John Doe"] }
+    ]
+}
+)";
+
+/**
+ * @brief Get a path for a snapshot in the temporary directory.
+ * @param name The name of the snapshot file.
+ * @return The path of the file.
+ */
+std::string snapshotPath(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+} // namespace
+
+void ConferenceSnapshotTest::SetUp()
+{
+}
+
+void ConferenceSnapshotTest::TearDown()
+{
+}
+
+TEST_F(ConferenceSnapshotTest, RestoresTheReviewedConference)
+{
+    std::istringstream input(CONFERENCE_DOCUMENT);
+    const auto conference = ConferenceLoader::load(input);
+    ConferenceManager conferenceManager(conference, 2);
+    testing::internal::CaptureStdout();
+    conferenceManager.startBidding(std::chrono::system_clock::now());
+    conferenceManager.runBidding();
+    conferenceManager.startRevision(std::chrono::system_clock::now());
+    conferenceManager.runReview();
+    testing::internal::GetCapturedStdout();
+
+    const auto path = snapshotPath("comfy_chair_snapshot_test.bin");
+    ConferenceSnapshot::write(*conference, path);
+    const auto restored = ConferenceSnapshot::load(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(restored->seed(), 7);
+    EXPECT_EQ(restored->createdAt(), conference->createdAt());
+    EXPECT_EQ(restored->sizeParticipants(), conference->sizeParticipants());
+    ASSERT_EQ(restored->tracks().size(), 3);
+    for (size_t index = 0; index < restored->tracks().size(); ++index)
+    {
+        const auto& original = *conference->tracks()[index];
+        const auto& track = *restored->tracks()[index];
+        EXPECT_EQ(track.trackName(), original.trackName());
+        EXPECT_TRUE(track.state().is<ReviewStateTrack>());
+
+        ASSERT_EQ(track.reviewers().size(), original.reviewers().size());
+        for (size_t reviewer = 0; reviewer < track.reviewers().size(); ++reviewer)
+        {
+            EXPECT_EQ(track.reviewers()[reviewer]->fullNames(), original.reviewers()[reviewer]->fullNames());
+        }
+
+        ASSERT_EQ(track.articles().size(), original.articles().size());
+        for (size_t article = 0; article < track.articles().size(); ++article)
+        {
+            EXPECT_EQ(track.articles()[article]->articleName(), original.articles()[article]->articleName());
+            EXPECT_EQ(track.articles()[article]->authors(), original.articles()[article]->authors());
+        }
+
+        ASSERT_EQ(track.bidMatrix().size(), original.bidMatrix().size());
+        for (ArticleId article = 0; article < track.bidMatrix().articles(); ++article)
+        {
+            for (ReviewerId reviewer = 0; reviewer < track.bidMatrix().reviewers(); ++reviewer)
+            {
+                EXPECT_EQ(track.bidMatrix().at(reviewer, article), original.bidMatrix().at(reviewer, article));
+            }
+        }
+
+        ASSERT_EQ(track.reviewStore().articles(), original.reviewStore().articles());
+        for (ArticleId article = 0; article < track.reviewStore().articles(); ++article)
+        {
+            const auto actualReviews = track.reviewStore().articleReviews(article);
+            const auto expectedReviews = original.reviewStore().articleReviews(article);
+            ASSERT_EQ(actualReviews.size(), expectedReviews.size());
+            for (size_t review = 0; review < actualReviews.size(); ++review)
+            {
+                const auto expected = original.reviewStore().review(expectedReviews[review]);
+                const auto actual = track.reviewStore().review(actualReviews[review]);
+                EXPECT_EQ(actual.reviewText(), expected.reviewText());
+                EXPECT_EQ(actual.rating(), expected.rating());
+                EXPECT_EQ(actual.confidence(), expected.confidence());
+                EXPECT_EQ(track.reviewStore()[actualReviews[review]].reviewer,
+                          original.reviewStore()[expectedReviews[review]].reviewer);
+            }
+        }
+    }
+
+    // The restored reviewers are the users of the restored conference
+    EXPECT_EQ(restored->tracks()[0]->reviewers()[0], restored->tracks()[2]->reviewers()[0]);
+}
+
+TEST_F(ConferenceSnapshotTest, LeavesThePasswordsOut)
+{
+    std::istringstream input(CONFERENCE_DOCUMENT);
+    const auto conference = ConferenceLoader::load(input);
+    const auto path = snapshotPath("comfy_chair_snapshot_password_test.bin");
+    ConferenceSnapshot::write(*conference, path);
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(bytes.find("secret"), std::string::npos);
+
+    // The restored users keep everything else
+    const auto restored = ConferenceSnapshot::load(path);
+    std::remove(path.c_str());
+    ASSERT_EQ(restored->sizeParticipants(), conference->sizeParticipants());
+    EXPECT_EQ(restored->tracks()[0]->reviewers()[1]->email(), conference->tracks()[0]->reviewers()[1]->email());
+    EXPECT_NE(std::dynamic_pointer_cast<Reviewer>(restored->tracks()[0]->reviewers()[1]), nullptr);
+}
+
+TEST_F(ConferenceSnapshotTest, RejectsForeignFiles)
+{
+    std::istringstream input(CONFERENCE_DOCUMENT);
+    const auto conference = ConferenceLoader::load(input);
+    const auto path = snapshotPath("comfy_chair_snapshot_version_test.bin");
+    ConferenceSnapshot::write(*conference, path);
+    EXPECT_NO_THROW(ConferenceSnapshot::load(path));
+
+    // Another version of the format
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint32_t version = ConferenceSnapshot::VERSION + 1;
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    EXPECT_THROW(ConferenceSnapshot::load(path), std::runtime_error);
+
+    // Not a snapshot at all
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << CONFERENCE_DOCUMENT;
+    EXPECT_THROW(ConferenceSnapshot::load(path), std::runtime_error);
+    std::remove(path.c_str());
+
+    EXPECT_THROW(ConferenceSnapshot::load(snapshotPath("comfy_chair_missing_snapshot.bin")), std::runtime_error);
+}
@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef CONFERENCE_SNAPSHOT_TEST_HPP
+#define CONFERENCE_SNAPSHOT_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "conferenceSnapshot.hpp"
+
+/**
+ * @brief Runs unit tests for ConferenceSnapshot.
+ *
+ */
+class ConferenceSnapshotTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    ConferenceSnapshotTest() = default;
+    ~ConferenceSnapshotTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // CONFERENCE_SNAPSHOT_TEST_HPP
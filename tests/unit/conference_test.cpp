@@ -8,6 +8,7 @@
 
 #include "conference_test.hpp"
 #include "conference.hpp"
+#include "conferenceGenerator.hpp"
 #include "trackFactory.hpp"
 
 void ConferenceTest::SetUp()
@@ -129,3 +130,93 @@ TEST_F(ConferenceTest, ConferenceCreation)
     EXPECT_EQ(conference->sizeParticipants(), 4);
     EXPECT_EQ(conference->tracks().size(), 2);
 }
+
+TEST_F(ConferenceTest, ConferenceSeed)
+{
+    const auto& jsonConference = R"(
+  {
+    "createdAt": "2024-07-18T00:00:00Z",
+    "seed": 2024,
+    "users": [
+        {
+            "name": "John Doe",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "john.doe@example.com",
+            "isChair": false,
+            "isReviewer": true,
+            "isAuthor": false
+        }
+    ]
+}
+    )"_json;
+
+    conference = std::make_shared<Conference>(jsonConference);
+    EXPECT_EQ(conference->seed(), 2024);
+
+    conference->seed(7);
+    EXPECT_EQ(conference->seed(), 7);
+}
+
+TEST_F(ConferenceTest, GeneratedConference)
+{
+    const ConferenceShape shape{.tracks = 4, .articles = 25, .reviewers = 10, .reviewersPerTrack = 6, .authors = 30};
+    const ConferenceGenerator generator(shape);
+
+    conference = generator.conference();
+    generator.submit(*conference);
+    EXPECT_EQ(conference->sizeParticipants(), 40);
+    ASSERT_EQ(conference->tracks().size(), 4);
+    for (const auto& track : conference->tracks())
+    {
+        EXPECT_EQ(track->amountArticles(), 25);
+        EXPECT_EQ(track->reviewers().size(), 6);
+    }
+
+    // The same shape yields the same conference
+    EXPECT_EQ(ConferenceGenerator(shape).describe(), generator.describe());
+    const auto articles = ConferenceGenerator(shape).articles(2);
+    ASSERT_EQ(articles.size(), 25);
+    for (size_t article = 0; article < articles.size(); ++article)
+    {
+        EXPECT_EQ(articles[article]->articleName(), conference->tracks()[2]->articles()[article]->articleName());
+        EXPECT_EQ(articles[article]->authors(), conference->tracks()[2]->articles()[article]->authors());
+        EXPECT_FALSE(articles[article]->authors().empty());
+    }
+}
+
+TEST_F(ConferenceTest, DuplicateUsersAreReported)
+{
+    const auto& jsonConference = R"(
+  {
+    "createdAt": "2024-07-18T00:00:00Z",
+    "users": [
+        {
+            "name": "John Doe",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "john.doe@example.com",
+            "isChair": false,
+            "isReviewer": true,
+            "isAuthor": false
+        },
+        {
+            "name": "John Doe",
+            "affiliation": "Other University",
+            "password": "password",
+            "email": "namesake@example.com",
+            "isChair": false,
+            "isReviewer": false,
+            "isAuthor": true
+        }
+    ]
+}
+    )"_json;
+
+    // The namesake is reported instead of silently taking the affiliation of the first user
+    testing::internal::CaptureStdout();
+    conference = std::make_shared<Conference>(jsonConference);
+    const auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("User 'John Doe' is already registered with an affiliation other than 'Other University'"),
+              std::string::npos);
+}
@@ -0,0 +1,92 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "metrics_test.hpp"
+#include "metrics.hpp"
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <stdexcept>
+
+void MetricsTest::SetUp()
+{
+    if constexpr (!METRICS_ENABLED)
+    {
+        GTEST_SKIP() << "The metrics are compiled out";
+    }
+}
+
+void MetricsTest::TearDown()
+{
+}
+
+TEST_F(MetricsTest, SeriesRecordTheirValues)
+{
+    // A series is created once per name and labels, and keeps its address
+    auto& bids = metrics.counter("bids_total", {{"track", "C++"}});
+    EXPECT_EQ(&metrics.counter("bids_total", {{"track", "C++"}}), &bids);
+    EXPECT_NE(&metrics.counter("bids_total", {{"track", "Rust"}}), &bids);
+    bids.add(3);
+    bids.add();
+    EXPECT_EQ(bids.value(), 4);
+
+    auto& heap = metrics.gauge("heap_bytes");
+    heap.set(-512.0);
+    EXPECT_EQ(heap.value(), -512.0);
+
+    auto& durations = metrics.histogram("phase_seconds", {{"phase", "bidding"}});
+    durations.observe(5e-7);
+    durations.observe(0.002);
+    durations.observe(1000.0);
+    EXPECT_EQ(durations.count(), 3);
+    EXPECT_DOUBLE_EQ(durations.sum(), 1000.0020005);
+    EXPECT_EQ(durations.cumulative(0), 1);
+    EXPECT_EQ(durations.cumulative(4), 2);
+    EXPECT_EQ(durations.cumulative(Histogram::BOUNDS.size() - 1), 2);
+
+    {
+        ScopedTimer timer(&durations);
+    }
+    EXPECT_EQ(durations.count(), 4);
+
+    // Resetting clears the values but keeps the series
+    metrics.reset();
+    EXPECT_EQ(bids.value(), 0);
+    EXPECT_EQ(heap.value(), 0.0);
+    EXPECT_EQ(durations.count(), 0);
+    EXPECT_EQ(&metrics.counter("bids_total", {{"track", "C++"}}), &bids);
+}
+
+TEST_F(MetricsTest, ExportsJsonAndPrometheus)
+{
+    metrics.counter("rejected_total", {{"track", "Say \"hi\""}, {"error", "phaseClosed"}}).add(2);
+    metrics.gauge("heap_bytes", {{"phase", "review"}}).set(1024.0);
+    metrics.histogram("phase_seconds").observe(0.5);
+
+    std::ostringstream prometheus;
+    metrics.writePrometheus(prometheus);
+    const auto text = prometheus.str();
+    EXPECT_NE(text.find("# TYPE rejected_total counter\n"), std::string::npos);
+    EXPECT_NE(text.find("rejected_total{track=\"Say \\\"hi\\\"\",error=\"phaseClosed\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("heap_bytes{phase=\"review\"} 1024\n"), std::string::npos);
+    EXPECT_NE(text.find("phase_seconds_bucket{le=\"0.1\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("phase_seconds_bucket{le=\"1\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("phase_seconds_bucket{le=\"+Inf\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("phase_seconds_sum 0.5\n"), std::string::npos);
+    EXPECT_NE(text.find("phase_seconds_count 1\n"), std::string::npos);
+
+    std::ostringstream json;
+    metrics.writeJson(json);
+    const auto document = nlohmann::json::parse(json.str());
+    EXPECT_EQ(document["counters"][0]["labels"]["error"], "phaseClosed");
+    EXPECT_EQ(document["counters"][0]["value"], 2);
+    EXPECT_EQ(document["gauges"][0]["value"], 1024.0);
+    EXPECT_EQ(document["histograms"][0]["count"], 1);
+    EXPECT_EQ(document["histograms"][0]["buckets"][6]["count"], 1);
+
+    EXPECT_THROW(metrics.write("/nonexistent/metrics.prom"), std::invalid_argument);
+}
@@ -0,0 +1,43 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef METRICS_TEST_HPP
+#define METRICS_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "metrics.hpp"
+
+/**
+ * @brief Runs unit tests for Metrics.
+ *
+ */
+class MetricsTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    MetricsTest() = default;
+    ~MetricsTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+
+    Metrics metrics; /**< A registry of its own, independent of the global one. */
+};
+
+#endif // METRICS_TEST_HPP
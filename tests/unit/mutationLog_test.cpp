@@ -0,0 +1,370 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "mutationLog_test.hpp"
+#include "articleRegular.hpp"
+#include "assignmentStrategyOptimal.hpp"
+#include "conference.hpp"
+#include "conferenceManager.hpp"
+#include "mutationLog.hpp"
+#include "trackPhase.hpp"
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const char* const CONFERENCE_DOCUMENT = R"(
+{
+    "createdAt": "2024-07-18T00:00:00Z",
+    "seed": 11,
+    "users": [
+        {
+            "name": "John Doe",
+            "affiliation": "Example University",
+            "password": "password",
+            "email": "john.doe@example.com",
+            "isChair": true,
+            "isReviewer": true,
+            "isAuthor": false
+        },
+        {
+            "name": "Alice Brown",
+            "affiliation": "Example Institute",
+            "password": "secret",
+            "email": "alice.brown@example.com",
+            "isChair": false,
+            "isReviewer": true,
+            "isAuthor": false
+        }
+    ],
+    "tracks": [
+        { "trackType": "regular", "trackTopic": "C++", "reviewers": ["John Doe", "Alice Brown"] },
+        { "trackType": "workshop", "trackTopic": "Data Science", "reviewers": ["Alice Brown"] }
+    ]
+}
+)";
+
+/**
+ * @brief Get a fresh path for a log in the temporary directory.
+ * @param name The name of the log file.
+ * @return The path of the file, removed if it existed.
+ */
+std::string logPath(const std::string& name)
+{
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+/**
+ * @brief Create a regular article.
+ * @param title The title of the article.
+ * @param abstract The abstract of the article.
+ * @return The article.
+ */
+std::shared_ptr<Article> makeArticle(const std::string& title, const std::string& abstract)
+{
+    return std::make_shared<ArticleRegular>(title, "https://bit.ly/example", std::vector<std::string>{"Jane Smith"},
+                                            abstract);
+}
+} // namespace
+
+void MutationLogTest::SetUp()
+{
+}
+
+void MutationLogTest::TearDown()
+{
+}
+
+TEST_F(MutationLogTest, ReplaysTheMutations)
+{
+    const auto path = logPath("comfy_chair_mutation_log_test.wal");
+    auto conference = std::make_shared<Conference>(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    testing::internal::CaptureStdout();
+    {
+        const auto log = std::make_shared<MutationLog>(path);
+        conference->mutationLog(log);
+        for (const auto& track : conference->tracks())
+        {
+            track->handleTrackArticle(makeArticle("Advanced C++ Techniques", "Concepts and ranges."),
+                                      OperationType::Create);
+            track->handleTrackArticle(makeArticle("Modern C++ Concurrency", "Threads and atomics."),
+                                      OperationType::Create);
+            track->handleTrackArticle(makeArticle("Legacy C++", "Macros everywhere."), OperationType::Create);
+        }
+        conference->tracks()[0]->handleTrackArticle(makeArticle("Advanced C++ Techniques", "Coroutines."),
+                                                    OperationType::Update);
+        conference->tracks()[1]->handleTrackArticle(makeArticle("Legacy C++", "Macros everywhere."),
+                                                    OperationType::Delete);
+
+        ConferenceManager conferenceManager(conference, 2);
+        conferenceManager.startBidding(std::chrono::system_clock::now());
+        conferenceManager.runBidding();
+        conferenceManager.startRevision(std::chrono::system_clock::now());
+        conferenceManager.runReview();
+        conference->mutationLog(nullptr);
+    }
+
+    // Restart from the document the conference was loaded from
+    Conference restored(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    const auto records = MutationLog::replay(path, restored);
+    testing::internal::GetCapturedStdout();
+
+    // Eight article operations, four state transitions, the bids of each track and one record per review
+    size_t reviews = 0;
+    for (const auto& track : conference->tracks())
+    {
+        reviews += track->reviewStore().size();
+    }
+    EXPECT_EQ(records, 14 + reviews);
+
+    ASSERT_EQ(restored.tracks().size(), conference->tracks().size());
+    for (size_t index = 0; index < restored.tracks().size(); ++index)
+    {
+        const auto& original = *conference->tracks()[index];
+        const auto& track = *restored.tracks()[index];
+        EXPECT_TRUE(track.state().is<ReviewStateTrack>());
+
+        ASSERT_EQ(track.articles().size(), original.articles().size());
+        for (size_t article = 0; article < track.articles().size(); ++article)
+        {
+            const auto* expected = dynamic_cast<const ArticleRegular*>(original.articles()[article].get());
+            const auto* actual = dynamic_cast<const ArticleRegular*>(track.articles()[article].get());
+            ASSERT_NE(actual, nullptr);
+            EXPECT_EQ(actual->articleName(), expected->articleName());
+            EXPECT_EQ(actual->abstract(), expected->abstract());
+        }
+
+        EXPECT_EQ(track.amountBids(), original.amountBids());
+        for (ArticleId article = 0; article < track.bidMatrix().articles(); ++article)
+        {
+            for (ReviewerId reviewer = 0; reviewer < track.bidMatrix().reviewers(); ++reviewer)
+            {
+                EXPECT_EQ(track.bidMatrix().at(reviewer, article), original.bidMatrix().at(reviewer, article));
+            }
+        }
+
+        ASSERT_EQ(track.amountReviews(), original.amountReviews());
+        for (ArticleId article = 0; article < track.reviewStore().articles(); ++article)
+        {
+            const auto reviews = track.reviewStore().articleReviews(article);
+            const auto expected = original.reviewStore().articleReviews(article);
+            ASSERT_EQ(reviews.size(), expected.size());
+            for (size_t review = 0; review < reviews.size(); ++review)
+            {
+                const auto& actual = track.reviewStore()[reviews[review]];
+                const auto& stored = original.reviewStore()[expected[review]];
+                EXPECT_EQ(actual.reviewer, stored.reviewer);
+                EXPECT_EQ(actual.rating, stored.rating);
+            }
+        }
+    }
+    EXPECT_EQ(dynamic_cast<const ArticleRegular*>(restored.tracks()[0]->articles()[0].get())->abstract(),
+              "Coroutines.");
+    EXPECT_EQ(restored.tracks()[1]->amountArticles(), 2);
+    std::filesystem::remove(path);
+}
+
+TEST_F(MutationLogTest, JournalsBatchesPerArticle)
+{
+    const auto path = logPath("comfy_chair_batch_mutation_log_test.wal");
+    Conference conference(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    testing::internal::CaptureStdout();
+    {
+        const auto log = std::make_shared<MutationLog>(path);
+        conference.mutationLog(log);
+
+        // A batch is journaled as one record per accepted article, the duplicate being left out
+        const std::vector<std::shared_ptr<Article>> articles{
+            makeArticle("Advanced C++ Techniques", "Concepts and ranges."),
+            makeArticle("Modern C++ Concurrency", "Threads and atomics."),
+            makeArticle("Advanced C++ Techniques", "Concepts, again.")};
+        const auto results = conference.tracks()[0]->handleTrackArticles(articles, OperationType::Create);
+        EXPECT_TRUE(results[0]);
+        EXPECT_TRUE(results[1]);
+        EXPECT_FALSE(results[2]);
+        conference.mutationLog(nullptr);
+    }
+    testing::internal::GetCapturedStdout();
+
+    Conference restored(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    EXPECT_EQ(MutationLog::replay(path, restored), 2);
+    const auto& track = *restored.tracks()[0];
+    ASSERT_EQ(track.amountArticles(), 2);
+    EXPECT_EQ(track.articles()[0]->articleName(), "Advanced C++ Techniques");
+    EXPECT_EQ(dynamic_cast<const ArticleRegular*>(track.articles()[0].get())->abstract(), "Concepts and ranges.");
+    EXPECT_EQ(track.articles()[1]->articleName(), "Modern C++ Concurrency");
+    std::filesystem::remove(path);
+}
+
+TEST_F(MutationLogTest, JournalsOnlyAppliedOperations)
+{
+    const auto path = logPath("comfy_chair_rejected_mutation_log_test.wal");
+    Conference conference(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    const auto& late = conference.tracks()[0];
+    const auto& open = conference.tracks()[1];
+    late->establishState(BiddingStateTrack{});
+
+    testing::internal::CaptureStdout();
+    const auto log = std::make_shared<MutationLog>(path);
+    conference.mutationLog(log);
+
+    // Submissions after the deadline are rejected before anything is recorded
+    EXPECT_EQ(late->handleTrackArticle(makeArticle("Late", "Submitted too late."), OperationType::Create).error(),
+              TrackError::PhaseClosed);
+    const std::vector<std::shared_ptr<Article>> batch{makeArticle("Later", "Submitted even later."),
+                                                      makeArticle("Latest", "Submitted much too late.")};
+    for (const auto& result : late->handleTrackArticles(batch, OperationType::Create))
+    {
+        EXPECT_EQ(result.error(), TrackError::PhaseClosed);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 0);
+
+    // Only the accepted one of the operations the reception state decides on is recorded
+    EXPECT_TRUE(open->handleTrackArticle(makeArticle("Legacy C++", "Macros everywhere."), OperationType::Create));
+    const auto accepted = std::filesystem::file_size(path);
+    EXPECT_GT(accepted, 0);
+    EXPECT_FALSE(open->handleTrackArticle(makeArticle("Legacy C++", "Macros, again."), OperationType::Create));
+    EXPECT_FALSE(open->handleTrackArticle(makeArticle("Missing", "Never submitted at all."), OperationType::Update));
+    EXPECT_FALSE(open->handleTrackArticle(makeArticle("Missing", "Never submitted at all."), OperationType::Delete));
+    for (const auto& result : open->handleTrackArticles(batch, OperationType::Delete))
+    {
+        EXPECT_FALSE(result);
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), accepted);
+    conference.mutationLog(nullptr);
+    testing::internal::GetCapturedStdout();
+
+    Conference restored(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    EXPECT_EQ(MutationLog::replay(path, restored), 1);
+    EXPECT_EQ(restored.tracks()[1]->amountArticles(), 1);
+    std::filesystem::remove(path);
+}
+
+TEST_F(MutationLogTest, JournalsOnlyTheChanges)
+{
+    const auto path = logPath("comfy_chair_delta_mutation_log_test.wal");
+    auto conference = std::make_shared<Conference>(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    const auto& track = conference->tracks()[0];
+    track->assignmentStrategy(std::make_shared<AssignmentStrategyOptimal>(2));
+
+    testing::internal::CaptureStdout();
+    const auto log = std::make_shared<MutationLog>(path);
+    conference->mutationLog(log);
+    for (const auto& title : {"Advanced C++ Techniques", "Modern C++ Concurrency", "Legacy C++"})
+    {
+        track->handleTrackArticle(makeArticle(title, "Concepts and ranges."), OperationType::Create);
+    }
+
+    // Bidding again draws the same bids, so there is no change to record
+    track->establishState(BiddingStateTrack{});
+    EXPECT_TRUE(track->handleTrackBidding());
+    const auto bid = std::filesystem::file_size(path);
+    EXPECT_TRUE(track->handleTrackBidding());
+    EXPECT_EQ(std::filesystem::file_size(path), bid);
+
+    // The review phase records the reviews it adds to the submitted one, and nothing once every article is full
+    track->establishState(ReviewStateTrack{});
+    EXPECT_TRUE(track->submitReview(0, Review("Solid work", Rating::Good, Confidence::High)));
+    EXPECT_TRUE(track->handleTrackReview());
+    const auto reviewed = std::filesystem::file_size(path);
+    EXPECT_TRUE(track->handleTrackReview());
+    EXPECT_EQ(std::filesystem::file_size(path), reviewed);
+    conference->mutationLog(nullptr);
+
+    // Three articles, two state transitions, the bids, the submitted review and the five the phase added
+    Conference restored(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    EXPECT_EQ(MutationLog::replay(path, restored), 12);
+    testing::internal::GetCapturedStdout();
+
+    // Every review keeps its reviewer, so no reviewer is assigned an article it already reviewed
+    const auto& original = track->reviewStore();
+    const auto& reviews = restored.tracks()[0]->reviewStore();
+    ASSERT_EQ(reviews.size(), original.size());
+    for (std::uint32_t review = 0; review < reviews.size(); ++review)
+    {
+        EXPECT_EQ(reviews[review].reviewer, original[review].reviewer);
+        EXPECT_EQ(reviews[review].article, original[review].article);
+    }
+    EXPECT_EQ(reviews[0].reviewer, ReviewStore::NO_REVIEWER);
+    EXPECT_EQ(reviews.reviewerReviews(0).size() + reviews.reviewerReviews(1).size(), 5);
+    EXPECT_EQ(restored.tracks()[0]->articleScores()[0].count(), 2);
+    std::filesystem::remove(path);
+}
+
+TEST_F(MutationLogTest, DropsTornRecords)
+{
+    const auto path = logPath("comfy_chair_torn_mutation_log_test.wal");
+    Conference conference(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    {
+        const auto log = std::make_shared<MutationLog>(path);
+        TrackJournal journal(log, 0);
+        journal.article(*makeArticle("Advanced C++ Techniques", "Concepts and ranges."), OperationType::Create);
+        journal.article(*makeArticle("Modern C++ Concurrency", "Threads and atomics."), OperationType::Create);
+    }
+    const auto complete = std::filesystem::file_size(path);
+
+    // A crash in the middle of the next record
+    std::ofstream(path, std::ios::binary | std::ios::app) << std::string("\x40\x00\x00\x00garbage", 11);
+    EXPECT_EQ(MutationLog::replay(path, conference), 2);
+    EXPECT_EQ(std::filesystem::file_size(path), complete);
+    EXPECT_EQ(conference.tracks()[0]->amountArticles(), 2);
+
+    // A record for a track the conference does not have
+    {
+        const auto log = std::make_shared<MutationLog>(path);
+        TrackJournal(log, 7).state("Bidding");
+    }
+    Conference restarted(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    EXPECT_THROW(MutationLog::replay(path, restarted), std::runtime_error);
+
+    std::filesystem::remove(path);
+    EXPECT_EQ(MutationLog::replay(path, restarted), 0);
+}
+
+TEST_F(MutationLogTest, GroupsConcurrentCommits)
+{
+    constexpr int SUBMITTERS = 8;
+    constexpr int SUBMISSIONS = 25;
+    const auto path = logPath("comfy_chair_group_commit_test.wal");
+    Conference conference(nlohmann::json::parse(CONFERENCE_DOCUMENT));
+    {
+        const auto log = std::make_shared<MutationLog>(path, std::chrono::milliseconds(2));
+        std::vector<std::thread> submitters;
+        for (int submitter = 0; submitter < SUBMITTERS; ++submitter)
+        {
+            submitters.emplace_back([&log, submitter] {
+                TrackJournal journal(log, 0);
+                for (int submission = 0; submission < SUBMISSIONS; ++submission)
+                {
+                    journal.article(*makeArticle("Article " + std::to_string(submitter) + "-" +
+                                                     std::to_string(submission),
+                                                 "Concepts and ranges."),
+                                    OperationType::Create);
+                }
+            });
+        }
+        for (auto& submitter : submitters)
+        {
+            submitter.join();
+        }
+        EXPECT_LT(log->syncs(), SUBMITTERS * SUBMISSIONS);
+
+        log->truncate();
+        EXPECT_EQ(std::filesystem::file_size(path), 0);
+        TrackJournal(log, 0).article(*makeArticle("After the snapshot", "Snapshots."), OperationType::Create);
+    }
+
+    EXPECT_EQ(MutationLog::replay(path, conference), 1);
+    EXPECT_EQ(conference.tracks()[0]->amountArticles(), 1);
+    std::filesystem::remove(path);
+}
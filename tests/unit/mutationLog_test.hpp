@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef MUTATION_LOG_TEST_HPP
+#define MUTATION_LOG_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "mutationLog.hpp"
+
+/**
+ * @brief Runs unit tests for MutationLog.
+ *
+ */
+class MutationLogTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    MutationLogTest() = default;
+    ~MutationLogTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // MUTATION_LOG_TEST_HPP
@@ -0,0 +1,75 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "phaseExecutor_test.hpp"
+#include "phaseExecutor.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+void PhaseExecutorTest::SetUp()
+{
+}
+
+void PhaseExecutorTest::TearDown()
+{
+}
+
+TEST_F(PhaseExecutorTest, RunsEveryTaskOnce)
+{
+    PhaseExecutor executor(4);
+    EXPECT_EQ(executor.threads(), 4);
+
+    // The pool is reused, every batch must run each of its tasks exactly once
+    for (size_t tasks : {0, 1, 3, 1000})
+    {
+        std::vector<std::atomic<int>> runs(tasks);
+        executor.run(tasks, [&](size_t task) { runs[task].fetch_add(1); });
+        for (const auto& count : runs)
+        {
+            EXPECT_EQ(count.load(), 1);
+        }
+    }
+}
+
+TEST_F(PhaseExecutorTest, SingleThreadRunsInline)
+{
+    PhaseExecutor executor(1);
+    EXPECT_EQ(executor.threads(), 1);
+
+    const auto caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+    executor.run(5, [&](size_t task) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(task);
+    });
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(PhaseExecutorTest, RethrowsAfterEveryTask)
+{
+    PhaseExecutor executor(4);
+
+    std::atomic<size_t> finished{0};
+    EXPECT_THROW(executor.run(64,
+                              [&](size_t task) {
+                                  if (task % 8 == 0)
+                                  {
+                                      throw std::runtime_error("Track failed");
+                                  }
+                                  finished.fetch_add(1);
+                              }),
+                 std::runtime_error);
+    EXPECT_EQ(finished.load(), 56);
+
+    // A failed batch leaves the pool usable
+    std::atomic<size_t> runs{0};
+    executor.run(16, [&](size_t) { runs.fetch_add(1); });
+    EXPECT_EQ(runs.load(), 16);
+}
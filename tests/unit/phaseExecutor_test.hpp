@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef PHASE_EXECUTOR_TEST_HPP
+#define PHASE_EXECUTOR_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "phaseExecutor.hpp"
+
+/**
+ * @brief Runs unit tests for PhaseExecutor.
+ *
+ */
+class PhaseExecutorTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    PhaseExecutorTest() = default;
+    ~PhaseExecutorTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // PHASE_EXECUTOR_TEST_HPP
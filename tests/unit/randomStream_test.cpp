@@ -0,0 +1,73 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "randomStream_test.hpp"
+#include "randomStream.hpp"
+#include <array>
+#include <vector>
+
+void RandomStreamTest::SetUp()
+{
+}
+
+void RandomStreamTest::TearDown()
+{
+}
+
+TEST_F(RandomStreamTest, PhiloxKnownAnswers)
+{
+    // Known answer vectors of the Random123 reference implementation
+    EXPECT_EQ(RandomStream::philox({0, 0, 0, 0}, 0),
+              (RandomStream::Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(RandomStream::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, 0xffffffffffffffffULL),
+              (RandomStream::Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+}
+
+TEST_F(RandomStreamTest, HashIsStable)
+{
+    EXPECT_EQ(RandomStream::hash(""), 0xcbf29ce484222325ULL);
+    EXPECT_EQ(RandomStream::hash("a"), 0xaf63dc4c8601ec8cULL);
+}
+
+TEST_F(RandomStreamTest, StreamsAreReproducible)
+{
+    const auto key = RandomStream::mix(42, RandomStream::hash("Martin Venturino"));
+    RandomStream first(key, 7, 1);
+    RandomStream second(key, 7, 1);
+    RandomStream otherStream(key, 8, 1);
+    RandomStream otherDomain(key, 7, 2);
+
+    size_t sameStream = 0;
+    size_t sameDomain = 0;
+    for (int draw = 0; draw < 64; ++draw)
+    {
+        const auto value = first.next();
+        EXPECT_EQ(value, second.next());
+        sameStream += value == otherStream.next();
+        sameDomain += value == otherDomain.next();
+    }
+    EXPECT_LT(sameStream, 2);
+    EXPECT_LT(sameDomain, 2);
+}
+
+TEST_F(RandomStreamTest, UniformCoversTheRange)
+{
+    RandomStream stream(RandomStream::mix(1, 2), 0);
+    std::array<size_t, 7> counts{};
+    for (int draw = 0; draw < 7000; ++draw)
+    {
+        const auto value = stream.uniform(7);
+        ASSERT_LT(value, 7);
+        ++counts[value];
+    }
+    for (const auto count : counts)
+    {
+        EXPECT_GT(count, 800);
+        EXPECT_LT(count, 1200);
+    }
+}
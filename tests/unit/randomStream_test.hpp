@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef RANDOM_STREAM_TEST_HPP
+#define RANDOM_STREAM_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "randomStream.hpp"
+
+/**
+ * @brief Runs unit tests for RandomStream.
+ *
+ */
+class RandomStreamTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    RandomStreamTest() = default;
+    ~RandomStreamTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // RANDOM_STREAM_TEST_HPP
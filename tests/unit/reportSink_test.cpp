@@ -0,0 +1,83 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reportSink_test.hpp"
+#include "articleRegular.hpp"
+#include "conference.hpp"
+#include "reportSinkJson.hpp"
+#include "reportSinkNull.hpp"
+#include "reportSinkText.hpp"
+#include <memory>
+#include <sstream>
+
+void ReportSinkTest::SetUp()
+{
+}
+
+void ReportSinkTest::TearDown()
+{
+}
+
+TEST_F(ReportSinkTest, TextSinkFillsThePlaceholders)
+{
+    std::ostringstream output;
+    {
+        ReportSinkText sink(output, 1024);
+        sink.report("articleRating", "Article '{}' has an average rating of {}",
+                    {{"article", "Advanced C++ Techniques"}, {"rating", -2}});
+        sink.report("trackError", "{}", {{"message", "Cannot handle articles in review state"}, {"track", "C++"}});
+
+        // Nothing reaches the stream until the buffer fills or is flushed
+        EXPECT_TRUE(output.str().empty());
+    }
+    EXPECT_EQ(output.str(), "Article 'Advanced C++ Techniques' has an average rating of -2\n"
+                            "Cannot handle articles in review state\n");
+
+    output.str("");
+    ReportSinkText unbuffered(output);
+    Review("Great \"paper\"", Rating::Good, Confidence::High).printReview(unbuffered);
+    EXPECT_EQ(output.str(), "Great \"paper\"\tRating: 1\tConfidence: 3\n");
+}
+
+TEST_F(ReportSinkTest, JsonSinkWritesNamedFields)
+{
+    std::ostringstream output;
+    ReportSinkJson sink(output);
+    Review("Great \"paper\"\n\x01", Rating::Good, Confidence::High).printReview(sink);
+    EXPECT_EQ(output.str(), "{\"event\":\"review\",\"text\":\"Great \\\"paper\\\"\\n\\u0001\",\"rating\":1,"
+                            "\"confidence\":3}\n");
+}
+
+TEST_F(ReportSinkTest, ConferenceReportsToItsSink)
+{
+    Conference conference(nlohmann::json::parse(R"(
+    {
+        "createdAt": "2024-07-18T00:00:00Z",
+        "users": [],
+        "tracks": [ { "trackType": "regular", "trackTopic": "C++" } ]
+    })"));
+    std::ostringstream output;
+    conference.reportSink(std::make_shared<ReportSinkJson>(output));
+
+    const auto& track = conference.tracks().front();
+    const auto article = std::make_shared<ArticleRegular>(
+        "Advanced C++ Techniques", "https://bit.ly/example", std::vector<std::string>{"Jane Smith"},
+        "Detailed exploration of modern C++ features.");
+    track->handleTrackArticle(article, OperationType::Create);
+    track->handleTrackArticle(article, OperationType::Create);
+    track->currentState();
+    EXPECT_EQ(output.str(), "{\"event\":\"articleExists\",\"article\":\"Advanced C++ Techniques\"}\n"
+                            "{\"event\":\"trackState\",\"track\":\"C++\",\"state\":\"Reception\"}\n");
+
+    // A null sink silences the conference entirely
+    conference.reportSink(std::make_shared<ReportSinkNull>());
+    testing::internal::CaptureStdout();
+    track->handleTrackArticle(article, OperationType::Create);
+    conference.printBiddingSummary();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+}
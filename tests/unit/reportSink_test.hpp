@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REPORT_SINK_TEST_HPP
+#define REPORT_SINK_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "reportSink.hpp"
+
+/**
+ * @brief Runs unit tests for ReportSink.
+ *
+ */
+class ReportSinkTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    ReportSinkTest() = default;
+    ~ReportSinkTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // REPORT_SINK_TEST_HPP
@@ -0,0 +1,88 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "reviewStore_test.hpp"
+#include "reviewStore.hpp"
+#include <string>
+#include <vector>
+
+void ReviewStoreTest::SetUp()
+{
+}
+
+void ReviewStoreTest::TearDown()
+{
+}
+
+TEST_F(ReviewStoreTest, InternsTexts)
+{
+    // Equal texts share one id and their bytes, whatever the string they come from
+    const auto signature = reviews.intern("I, John Doe, have reviewed this article");
+    EXPECT_EQ(reviews.intern(std::string("I, John Doe, have reviewed this article")), signature);
+    const auto other = reviews.intern("Needs work");
+    EXPECT_NE(other, signature);
+    EXPECT_EQ(reviews.intern(""), 2);
+    EXPECT_EQ(reviews.texts(), 3);
+    EXPECT_EQ(reviews.textBytes(), 49);
+
+    // Ids stay valid as the arena grows
+    EXPECT_EQ(reviews.text(signature), "I, John Doe, have reviewed this article");
+    EXPECT_EQ(reviews.text(other), "Needs work");
+    EXPECT_EQ(reviews.text(2), "");
+}
+
+TEST_F(ReviewStoreTest, ListsReviewsByArticleAndReviewer)
+{
+    EXPECT_TRUE(reviews.empty());
+    EXPECT_TRUE(reviews.articleReviews(0).empty());
+    EXPECT_TRUE(reviews.reviewerReviews(0).empty());
+
+    reviews.resize(2);
+    const auto text = reviews.intern("Solid work");
+    EXPECT_EQ(reviews.add(1, 0, text, Rating::Good, Confidence::High), 0);
+    EXPECT_EQ(reviews.add(0, 3, text, Rating::Bad, Confidence::Low), 1);
+    EXPECT_EQ(reviews.add(1, 3, Review("Solid work", Rating::Excellent, Confidence::Medium)), 2);
+
+    // Adding a review to an unknown article grows the lists, which never shrink
+    EXPECT_EQ(reviews.size(), 3);
+    EXPECT_EQ(reviews.articles(), 4);
+    reviews.resize(1);
+    EXPECT_EQ(reviews.articles(), 4);
+    EXPECT_EQ(reviews.texts(), 1);
+
+    EXPECT_EQ(std::vector<std::uint32_t>(reviews.articleReviews(3).begin(), reviews.articleReviews(3).end()),
+              (std::vector<std::uint32_t>{1, 2}));
+    EXPECT_TRUE(reviews.articleReviews(1).empty());
+    EXPECT_EQ(std::vector<std::uint32_t>(reviews.reviewerReviews(1).begin(), reviews.reviewerReviews(1).end()),
+              (std::vector<std::uint32_t>{0, 2}));
+
+    const auto& record = reviews[2];
+    EXPECT_EQ(record.reviewer, 1);
+    EXPECT_EQ(record.article, 3);
+    EXPECT_EQ(record.rating, Rating::Excellent);
+    EXPECT_EQ(record.confidence, Confidence::Medium);
+}
+
+TEST_F(ReviewStoreTest, MaterializesReviews)
+{
+    // Reviews without a reviewer are only listed by article
+    reviews.add(ReviewStore::NO_REVIEWER, 1, Review("Needs work", Rating::Bad, Confidence::High));
+    EXPECT_EQ(reviews.articleReviews(1).size(), 1);
+    EXPECT_TRUE(reviews.reviewerReviews(ReviewStore::NO_REVIEWER).empty());
+
+    const auto review = reviews.review(0);
+    EXPECT_EQ(review.reviewText(), "Needs work");
+    EXPECT_EQ(review.rating(), Rating::Bad);
+    EXPECT_EQ(review.confidence(), Confidence::High);
+
+    // A copy of the store owns its texts
+    const auto copy = reviews;
+    reviews.intern("Another text");
+    EXPECT_EQ(copy.text(copy[0].text), "Needs work");
+    EXPECT_EQ(copy.texts(), 1);
+}
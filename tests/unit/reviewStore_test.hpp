@@ -0,0 +1,43 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef REVIEW_STORE_TEST_HPP
+#define REVIEW_STORE_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "reviewStore.hpp"
+
+/**
+ * @brief Runs unit tests for ReviewStore.
+ *
+ */
+class ReviewStoreTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    ReviewStoreTest() = default;
+    ~ReviewStoreTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+
+    ReviewStore reviews; /**< An empty store. */
+};
+
+#endif // REVIEW_STORE_TEST_HPP
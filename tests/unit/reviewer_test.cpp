@@ -8,6 +8,8 @@
 
 #include "reviewer_test.hpp"
 #include "bid.hpp"
+#include "bidMatrix.hpp"
+#include "reviewStore.hpp"
 #include "reviewer.hpp"
 
 void ReviewerTest::SetUp()
@@ -125,3 +127,96 @@ TEST_F(ReviewerTest, ReviewerTitleTextReview)
         "nulla pariatur. Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit "
         "anim id est laborum.");
 }
+
+TEST_F(ReviewerTest, ReviewerSeededDecisions)
+{
+    auto twin = std::make_shared<Reviewer>(*reviewer);
+    reviewer->seed(7);
+    twin->seed(7);
+
+    // Keyed decisions only depend on the seed, the reviewer and the event, not on the call order
+    const auto lastBid = reviewer->determineInterest(3).biddingInterest();
+    const auto lastReview = reviewer->reviewArticle(3).rating();
+    for (std::uint64_t event = 0; event < 4; ++event)
+    {
+        twin->determineInterest(event);
+    }
+    EXPECT_EQ(twin->bids().back().biddingInterest(), lastBid);
+    EXPECT_EQ(twin->reviewArticle(3).rating(), lastReview);
+
+    // A different seed gives different decisions
+    twin->seed(8);
+    size_t same = 0;
+    for (std::uint64_t event = 0; event < 64; ++event)
+    {
+        reviewer->seed(7);
+        const auto rating = reviewer->reviewArticle(event).rating();
+        same += twin->reviewArticle(event).rating() == rating;
+    }
+    EXPECT_LT(same, 32);
+}
+
+TEST_F(ReviewerTest, ReviewerBidRate)
+{
+    EXPECT_FALSE(reviewer->bidRate().has_value());
+
+    auto userJson = nlohmann::json{{"name", "Gaston Valenzuela"},
+                                   {"affiliation", "Tecnicas y herramientas"},
+                                   {"email", "gaston@tyh.com"},
+                                   {"password", "1234"},
+                                   {"isChair", false},
+                                   {"isAuthor", false},
+                                   {"isReviewer", true},
+                                   {"bidRate", 0.0}};
+    Reviewer idle(userJson);
+    userJson["bidRate"] = 1.0;
+    Reviewer eager(userJson);
+    EXPECT_EQ(eager.bidRate(), 1.0);
+
+    // A reviewer bidding on no article never bids, one bidding on every article always does
+    for (std::uint64_t event = 0; event < 64; ++event)
+    {
+        EXPECT_EQ(idle.determineInterest(event).biddingInterest(), BiddingInterest::None);
+        EXPECT_NE(eager.determineInterest(event).biddingInterest(), BiddingInterest::None);
+    }
+
+    userJson["bidRate"] = 1.5;
+    EXPECT_THROW(Reviewer{userJson}, std::invalid_argument);
+}
+
+TEST_F(ReviewerTest, ReviewerStoresReviews)
+{
+    reviewer->seed(7);
+    ReviewStore reviews;
+    for (std::uint64_t event = 0; event < 8; ++event)
+    {
+        // The stored review is the review the reviewer writes for the same event
+        const auto& record = reviews[reviewer->reviewArticle(event, reviews, 2, static_cast<ArticleId>(event))];
+        const auto review = reviewer->reviewArticle(event);
+        EXPECT_EQ(record.rating, review.rating());
+        EXPECT_EQ(record.confidence, review.confidence());
+        EXPECT_EQ(reviews.text(record.text), review.reviewText());
+    }
+
+    // Only the standalone reviews are kept by the reviewer, and the store holds its text once
+    EXPECT_EQ(reviewer->reviews().size(), 8);
+    EXPECT_EQ(reviews.reviewerReviews(2).size(), 8);
+    EXPECT_EQ(reviews.texts(), 1);
+}
+
+TEST_F(ReviewerTest, ReviewerBidsIntoTheMatrix)
+{
+    reviewer->seed(7);
+    BidMatrix bids;
+    bids.reset(3, 8);
+    for (std::uint64_t event = 0; event < 8; ++event)
+    {
+        // The cell holds the interest the reviewer bids for the same event
+        reviewer->determineInterest(event, bids, 1, static_cast<ArticleId>(event));
+        EXPECT_EQ(bids.at(1, event), reviewer->determineInterest(event).biddingInterest());
+        EXPECT_EQ(bids.at(0, event), BiddingInterest::None);
+    }
+
+    // Only the standalone bids are kept by the reviewer
+    EXPECT_EQ(reviewer->bids().size(), 8);
+}
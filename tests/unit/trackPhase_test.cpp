@@ -0,0 +1,76 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#include "trackPhase_test.hpp"
+#include "reviewer.hpp"
+#include <memory>
+#include <vector>
+
+void TrackPhaseTest::SetUp()
+{
+}
+
+void TrackPhaseTest::TearDown()
+{
+}
+
+TEST_F(TrackPhaseTest, PhasesFollowTheirOrder)
+{
+    // A track starts receiving articles
+    const TrackPhase reception;
+    EXPECT_TRUE(reception.is<ReceptionStateTrack>());
+    EXPECT_EQ(reception.name(), "Reception");
+
+    // The phases are numbered and named in the order a track goes through them
+    const std::vector<std::string_view> names{"Reception", "Bidding", "Review", "Selection"};
+    for (size_t index = 0; index < names.size(); ++index)
+    {
+        const auto phase = TrackPhase::at(index);
+        ASSERT_TRUE(phase.has_value());
+        EXPECT_EQ(phase->index(), index);
+        EXPECT_EQ(phase->name(), names[index]);
+        EXPECT_EQ(TrackPhase::named(names[index])->index(), index);
+    }
+
+    EXPECT_FALSE(TrackPhase::at(names.size()).has_value());
+    EXPECT_FALSE(TrackPhase::named("Closed").has_value());
+}
+
+TEST_F(TrackPhaseTest, RejectedOperationsDoNotRun)
+{
+    nlohmann::json reviewerJson = {{"name", "Martin Venturino"}, {"affiliation", "UNC"}, {"email", "chair@tyh.com"},
+                                   {"password", "1234"},         {"isChair", false},     {"isAuthor", false},
+                                   {"isReviewer", true}};
+    const std::vector<std::shared_ptr<User>> reviewers{std::make_shared<Reviewer>(reviewerJson)};
+    const std::vector<std::shared_ptr<Article>> articles;
+    BidMatrix bids;
+    bids.reset(1, 1);
+
+    // Bidding is rejected while receiving articles, and the bids are left untouched
+    TrackPhase phase = ReceptionStateTrack{};
+    const auto rejected = phase.handleBidding(articles, 0, bids, reviewers);
+    EXPECT_FALSE(rejected);
+    EXPECT_EQ(rejected.error(), TrackError::PhaseClosed);
+    EXPECT_EQ(rejected.message(), ReceptionStateTrack::BIDDING_REJECTION);
+    EXPECT_EQ(bids.reviewers(), 1);
+    EXPECT_EQ(bids.articles(), 1);
+
+    // Submissions are rejected once bidding started
+    ArticleIndex index;
+    phase = BiddingStateTrack{};
+    EXPECT_EQ(phase.handleArticle(index, nullptr, OperationType::Create).message(),
+              "Cannot handle articles in Bidding state");
+    EXPECT_EQ(index.size(), 0);
+
+    // The phase allowing the operation runs it
+    const auto allowed = phase.handleBidding(articles, 0, bids, reviewers);
+    EXPECT_TRUE(allowed);
+    EXPECT_EQ(allowed.error(), TrackError::None);
+    EXPECT_TRUE(allowed.message().empty());
+    EXPECT_EQ(bids.articles(), 0);
+}
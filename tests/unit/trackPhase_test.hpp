@@ -0,0 +1,41 @@
+/*
+ * ComfyChair
+ * Copyright (C) 2024, M. Venturino, G. Valenzuela
+ * October 17, 2026.
+ *
+ * MIT License
+ */
+
+#ifndef TRACK_PHASE_TEST_HPP
+#define TRACK_PHASE_TEST_HPP
+
+#include "gtest/gtest.h"
+
+#include "trackPhase.hpp"
+
+/**
+ * @brief Runs unit tests for TrackPhase.
+ *
+ */
+class TrackPhaseTest : public ::testing::Test
+{
+  protected:
+    // LCOV_EXCL_START
+    TrackPhaseTest() = default;
+    ~TrackPhaseTest() = default;
+
+    /**
+     * @brief Set the environment for testing.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Clean the environment after testing.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // TRACK_PHASE_TEST_HPP
@@ -7,17 +7,45 @@
  */
 
 #include "track_test.hpp"
+#include "articleIndex.hpp"
 #include "articlePoster.hpp"
 #include "articleRegular.hpp"
+#include "assignmentStrategyOptimal.hpp"
 #include "bid.hpp"
+#include "bidMatrix.hpp"
 #include "itrackState.hpp"
+#include "leaderboard.hpp"
+#include "randomStream.hpp"
+#include "reportSinkNull.hpp"
+#include "reviewAggregate.hpp"
+#include "reviewer.hpp"
+#include "selectionStrategyBest.hpp"
 #include "selectionStrategyFixedCut.hpp"
 #include "track.hpp"
 #include "trackFactory.hpp"
+#include "trackPhase.hpp"
 #include "trackStateBidding.hpp"
 #include "trackStateReception.hpp"
 #include "trackStateReview.hpp"
 #include "trackStateSelection.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory_resource>
+#include <span>
+#include <thread>
+
+namespace
+{
+ReviewAggregate scoreOf(std::initializer_list<Rating> ratings)
+{
+    ReviewAggregate score;
+    for (const auto rating : ratings)
+    {
+        score.add(Review("", rating));
+    }
+    return score;
+}
+} // namespace
 
 void TrackTest::SetUp()
 {
@@ -122,9 +150,8 @@ TEST_F(TrackTest, RegularTrack)
     // Handle the article
     trackRegular->handleTrackArticle(articlePoster, OperationType::Create);
 
-    // Check amount of articles
-    // EXPECT_EQ(trackRegular->amountArticles(), 1); //Todo Uncomment this line when the minimum abstract size is 300
-    EXPECT_EQ(trackRegular->amountArticles(), 2);
+    // Check amount of articles, the second article shares the title of the first one and is rejected
+    EXPECT_EQ(trackRegular->amountArticles(), 1);
 
     // No bidding, review  or selection allowed
     testing::internal::CaptureStdout();
@@ -216,9 +243,8 @@ TEST_F(TrackTest, WorkshopTrack)
     // Handle the article
     trackWorkshop->handleTrackArticle(articlePoster, OperationType::Create);
 
-    // Check amount of articles
-    // EXPECT_EQ(trackWorkshop->amountArticles(), 2); //Todo Uncomment this line when the minimum abstract size is 300
-    EXPECT_EQ(trackWorkshop->amountArticles(), 3);
+    // Check amount of articles, every article shares the title of the first one and is rejected
+    EXPECT_EQ(trackWorkshop->amountArticles(), 1);
 
     // No bidding ni review allowed
     testing::internal::CaptureStdout();
@@ -382,6 +408,13 @@ TEST_F(TrackTest, TrackOperations)
 
     auto articleRegularV2 = std::make_shared<ArticleRegular>(jsonArticleRegularValid);
 
+    // An article with the same title cannot be created twice
+    testing::internal::CaptureStdout();
+    trackRegular->handleTrackArticle(articleRegularV2, OperationType::Create);
+    outputCurrentState = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ(outputCurrentState.c_str(), "Article already exists\n");
+    EXPECT_EQ(trackRegular->amountArticles(), 1);
+
     // Handle the article
     trackRegular->handleTrackArticle(articleRegularV2, OperationType::Update);
 
@@ -393,6 +426,13 @@ TEST_F(TrackTest, TrackOperations)
 
     // Check amount of articles
     EXPECT_EQ(trackRegular->amountArticles(), 0);
+
+    // Updating or deleting a missing article is reported
+    testing::internal::CaptureStdout();
+    trackRegular->handleTrackArticle(articleRegularV2, OperationType::Update);
+    trackRegular->handleTrackArticle(articleRegularV2, OperationType::Delete);
+    outputCurrentState = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ(outputCurrentState.c_str(), "Article not found\nArticle not found\n");
 }
 
 TEST_F(TrackTest, TrackBidding)
@@ -436,9 +476,9 @@ TEST_F(TrackTest, TrackBidding)
     // Handle the article
     trackRegular->handleTrackArticle(articleRegular, OperationType::Create);
 
-    auto selectionState = std::make_shared<BiddingStateTrack>();
+    const TrackPhase selectionState = BiddingStateTrack{};
 
-    EXPECT_TRUE(selectionState != nullptr);
+    EXPECT_TRUE(selectionState.is<BiddingStateTrack>());
 
     // Change state
     trackRegular->establishState(selectionState);
@@ -509,9 +549,9 @@ TEST_F(TrackTest, TrackSelection)
     // Handle the article
     trackRegular->handleTrackArticle(articleRegular, OperationType::Create);
 
-    auto selectionState = std::make_shared<SelectionStateTrack>();
+    const TrackPhase selectionState = SelectionStateTrack{};
 
-    EXPECT_TRUE(selectionState != nullptr);
+    EXPECT_TRUE(selectionState.is<SelectionStateTrack>());
 
     // Change state
     trackRegular->establishState(selectionState);
@@ -580,9 +620,9 @@ TEST_F(TrackTest, TrackReview)
     // Handle the article
     trackRegular->handleTrackArticle(articleRegular, OperationType::Create);
 
-    auto reviewState = std::make_shared<ReviewStateTrack>();
+    const TrackPhase reviewState = ReviewStateTrack{};
 
-    EXPECT_TRUE(reviewState != nullptr);
+    EXPECT_TRUE(reviewState.is<ReviewStateTrack>());
 
     // Change state
     trackRegular->establishState(reviewState);
@@ -611,3 +651,550 @@ TEST_F(TrackTest, TrackReview)
     outputCurrentState = testing::internal::GetCapturedStdout();
     EXPECT_STREQ(outputCurrentState.c_str(), "Cannot handle selection in review state\n");
 }
+
+TEST_F(TrackTest, ArticleIndexConsistency)
+{
+    ArticleIndex index;
+
+    // Create a few articles with different titles
+    std::vector<std::shared_ptr<Article>> articles;
+    for (const auto& title : {"Article A", "Article B", "Article C", "Article D"})
+    {
+        nlohmann::json articleJson = {{"articleTitle", title},
+                                      {"attachedFileUrl", "https://bit.ly/example"},
+                                      {"abstract", "An amazing paper of: C++"}};
+        articles.push_back(std::make_shared<ArticleRegular>(articleJson));
+        EXPECT_TRUE(index.insert(articles.back()));
+    }
+
+    // Duplicated titles are rejected
+    EXPECT_FALSE(index.insert(articles.front()));
+    EXPECT_EQ(index.size(), 4);
+
+    // Removing an article moves the last one into its slot and keeps the index consistent
+    EXPECT_TRUE(index.erase("Article A"));
+    EXPECT_FALSE(index.erase("Article A"));
+    EXPECT_EQ(index.size(), 3);
+    EXPECT_EQ(index.find("Article A"), nullptr);
+    for (const auto& title : {"Article B", "Article C", "Article D"})
+    {
+        ASSERT_NE(index.find(title), nullptr);
+        EXPECT_EQ(index.find(title)->articleName(), title);
+    }
+
+    // Removing the last article does not move anything
+    EXPECT_TRUE(index.erase(index.articles().back()->articleName()));
+    EXPECT_EQ(index.size(), 2);
+    for (const auto& article : index.articles())
+    {
+        EXPECT_EQ(index.find(article->articleName()), article.get());
+    }
+}
+
+TEST_F(TrackTest, BidMatrixKeepsEveryBid)
+{
+    // Create two reviewers and three articles
+    std::vector<std::shared_ptr<User>> reviewers;
+    for (const auto& name : {"Martin Venturino", "Gabriel Valenzuela"})
+    {
+        nlohmann::json reviewerJson = {{"name", name},       {"affiliation", "UNC"}, {"email", "chair@tyh.com"},
+                                       {"password", "1234"}, {"isChair", false},     {"isAuthor", false},
+                                       {"isReviewer", true}};
+        reviewers.push_back(std::make_shared<Reviewer>(reviewerJson));
+    }
+
+    std::vector<std::shared_ptr<Article>> articles;
+    for (const auto& title : {"Article A", "Article B", "Article C"})
+    {
+        nlohmann::json articleJson = {{"articleTitle", title},
+                                      {"attachedFileUrl", "https://bit.ly/example"},
+                                      {"abstract", "An amazing paper of: C++"}};
+        articles.push_back(std::make_shared<ArticleRegular>(articleJson));
+    }
+
+    // Every reviewer keeps its own bid on every article
+    BidMatrix matrix;
+    BiddingStateTrack biddingState;
+    biddingState.handleBidding(articles, 0, matrix, reviewers);
+    EXPECT_EQ(matrix.reviewers(), 2);
+    EXPECT_EQ(matrix.articles(), 3);
+    EXPECT_EQ(matrix.size(), 6);
+    for (size_t article = 0; article < matrix.articles(); ++article)
+    {
+        const auto bids = matrix.articleBids(article);
+        ASSERT_EQ(bids.size(), 2);
+        for (size_t reviewer = 0; reviewer < bids.size(); ++reviewer)
+        {
+            EXPECT_EQ(bids[reviewer], matrix.at(reviewer, article));
+        }
+    }
+
+    // Writing one cell does not touch its neighbours
+    matrix.reset(2, 3);
+    matrix.set(1, 2, BiddingInterest::Interested);
+    EXPECT_EQ(matrix.at(1, 2), BiddingInterest::Interested);
+    EXPECT_EQ(matrix.at(0, 2), BiddingInterest::None);
+    EXPECT_EQ(matrix.at(1, 1), BiddingInterest::None);
+
+    // Review assignment consumes the matrix and reviews every article
+    ReviewStore reviews;
+    Leaderboard scores;
+    ReviewStateTrack reviewState;
+    std::shared_ptr<AssignmentStrategy> strategy = std::make_shared<AssignmentStrategyOptimal>(2);
+    const ConflictIndex conflicts;
+    ReportSinkNull sink;
+    std::pmr::monotonic_buffer_resource arena;
+    reviewState.handleReview(articles, 0, matrix, strategy, conflicts, reviews, scores, reviewers, sink, arena);
+    ASSERT_EQ(reviews.articles(), 3);
+    ASSERT_EQ(scores.size(), 3);
+    for (ArticleId article = 0; article < reviews.articles(); ++article)
+    {
+        EXPECT_EQ(reviews.articleReviews(article).size(), 2);
+        EXPECT_EQ(scores[article].count(), 2);
+    }
+
+    // Each reviewer lists the reviews it wrote, all signed with the one text it interned
+    EXPECT_EQ(reviews.reviewerReviews(0).size() + reviews.reviewerReviews(1).size(), 6);
+    EXPECT_EQ(reviews.texts(), 2);
+}
+
+TEST_F(TrackTest, ReviewScratchComesFromTheArena)
+{
+    std::vector<std::shared_ptr<User>> reviewers;
+    for (const auto& name : {"Martin Venturino", "Gabriel Valenzuela", "Ada Lovelace"})
+    {
+        nlohmann::json reviewerJson = {{"name", name},       {"affiliation", "UNC"}, {"email", "chair@tyh.com"},
+                                       {"password", "1234"}, {"isChair", false},     {"isAuthor", false},
+                                       {"isReviewer", true}};
+        reviewers.push_back(std::make_shared<Reviewer>(reviewerJson));
+    }
+    std::vector<std::shared_ptr<Article>> articles;
+    for (const auto& title : {"Article A", "Article B", "Article C", "Article D"})
+    {
+        nlohmann::json articleJson = {{"articleTitle", title},
+                                      {"attachedFileUrl", "https://bit.ly/example"},
+                                      {"abstract", "An amazing paper of: C++"}};
+        articles.push_back(std::make_shared<ArticleRegular>(articleJson));
+    }
+
+    // The bids of the open articles are copied into a matrix of the arena
+    BidMatrix matrix;
+    BiddingStateTrack{}.handleBidding(articles, 0, matrix, reviewers);
+    ReviewStore reviews;
+    reviews.resize(articles.size());
+    reviews.add(ReviewStore::NO_REVIEWER, 0, Review("Solid work", Rating::Good, Confidence::High));
+    reviews.add(ReviewStore::NO_REVIEWER, 0, Review("Solid work", Rating::Good, Confidence::High));
+    Leaderboard scores;
+    std::shared_ptr<AssignmentStrategy> strategy = std::make_shared<AssignmentStrategyOptimal>(2);
+    const ConflictIndex conflicts;
+    ReportSinkNull sink;
+    std::pmr::monotonic_buffer_resource arena;
+
+    // Without a default resource, any transient container not built from the arena would throw
+    const auto defaultResource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    const ReviewStateTrack reviewState;
+    EXPECT_NO_THROW(
+        reviewState.handleReview(articles, 0, matrix, strategy, conflicts, reviews, scores, reviewers, sink, arena));
+    std::pmr::set_default_resource(defaultResource);
+    EXPECT_EQ(reviews.size(), 8);
+
+    BidMatrix arenaMatrix(&arena);
+    EXPECT_EQ(arenaMatrix.resource(), &arena);
+}
+
+TEST_F(TrackTest, TracksDrawTheirOwnDecisions)
+{
+    nlohmann::json reviewerJson = {{"name", "Martin Venturino"}, {"affiliation", "UNC"}, {"email", "chair@tyh.com"},
+                                   {"password", "1234"},         {"isChair", false},     {"isAuthor", false},
+                                   {"isReviewer", true}};
+    const std::vector<std::shared_ptr<User>> reviewers{std::make_shared<Reviewer>(reviewerJson)};
+    std::vector<std::shared_ptr<Article>> articles;
+    for (int article = 0; article < 32; ++article)
+    {
+        nlohmann::json articleJson = {{"articleTitle", "Article " + std::to_string(article)},
+                                      {"attachedFileUrl", "https://bit.ly/example"},
+                                      {"abstract", "An amazing paper of: C++"}};
+        articles.push_back(std::make_shared<ArticleRegular>(articleJson));
+    }
+
+    // The same titles give the same bids in the same track, and independent bids in another one
+    BidMatrix first;
+    BidMatrix again;
+    BidMatrix other;
+    BiddingStateTrack biddingState;
+    biddingState.handleBidding(articles, RandomStream::hash("C++"), first, reviewers);
+    biddingState.handleBidding(articles, RandomStream::hash("C++"), again, reviewers);
+    biddingState.handleBidding(articles, RandomStream::hash("Rust"), other, reviewers);
+    size_t same = 0;
+    for (ArticleId article = 0; article < articles.size(); ++article)
+    {
+        EXPECT_EQ(again.at(0, article), first.at(0, article));
+        same += other.at(0, article) == first.at(0, article);
+    }
+    EXPECT_LT(same, articles.size());
+}
+
+TEST_F(TrackTest, SelectionByArticleId)
+{
+    // Article 1 was never reviewed
+    const std::vector<ReviewAggregate> scores{scoreOf({Rating::Good}), {}, scoreOf({Rating::Excellent}),
+                                              scoreOf({Rating::Bad})};
+    std::vector<ArticleId> selected;
+
+    SelectionStrategyBest best;
+    best.select(selected, scores, 1);
+    EXPECT_EQ(selected, (std::vector<ArticleId>{0, 2}));
+
+    // Half of the three reviewed articles, best rated first
+    auto fixedCut = std::make_shared<SelectionStrategyFixedCut>();
+    fixedCut->select(selected, scores, 50);
+    EXPECT_EQ(selected, (std::vector<ArticleId>{2}));
+    fixedCut->select(selected, scores, 100);
+    EXPECT_EQ(selected, (std::vector<ArticleId>{2, 0, 3}));
+}
+
+TEST_F(TrackTest, FixedCutBreaksTiesById)
+{
+    // Many ties in the middle ratings
+    std::vector<ReviewAggregate> scores;
+    for (int article = 0; article < 20; ++article)
+    {
+        scores.push_back(scoreOf({static_cast<Rating>(article % 3 - 1)}));
+    }
+    scores[7] = ReviewAggregate();
+
+    // 19 reviewed articles, 6 with Good: 30% takes 5 of them, lowest ids first
+    auto fixedCut = std::make_shared<SelectionStrategyFixedCut>();
+    std::vector<ArticleId> selected;
+    fixedCut->select(selected, scores, 30);
+    EXPECT_EQ(selected, (std::vector<ArticleId>{2, 5, 8, 11, 14}));
+
+    // Every reviewed article, best scored first and by id within a score
+    fixedCut->select(selected, scores, 100);
+    ASSERT_EQ(selected.size(), 19);
+    EXPECT_TRUE(std::is_sorted(selected.begin(), selected.end(), [&](ArticleId a, ArticleId b) {
+        return scores[a].scoreKey() != scores[b].scoreKey() ? scores[a].scoreKey() > scores[b].scoreKey() : a < b;
+    }));
+
+    // The cut is the same on every run
+    std::vector<ArticleId> again;
+    fixedCut->select(again, scores, 100);
+    EXPECT_EQ(selected, again);
+}
+
+TEST_F(TrackTest, FixedCutIsSharedAcrossThreads)
+{
+    // Two tracks with opposite scores select through the one strategy at the same time
+    std::vector<ReviewAggregate> ascending;
+    std::vector<ReviewAggregate> descending;
+    for (int article = 0; article < 200; ++article)
+    {
+        ascending.push_back(scoreOf({static_cast<Rating>(article % 7 - 3)}));
+        descending.push_back(scoreOf({static_cast<Rating>(3 - article % 7)}));
+    }
+    auto fixedCut = std::make_shared<SelectionStrategyFixedCut>();
+    std::vector<ArticleId> expectedAscending;
+    std::vector<ArticleId> expectedDescending;
+    fixedCut->select(expectedAscending, ascending, 40);
+    fixedCut->select(expectedDescending, descending, 40);
+
+    const auto selectMany = [&](const std::vector<ReviewAggregate>& scores, const std::vector<ArticleId>& expected) {
+        std::vector<ArticleId> selected;
+        for (int run = 0; run < 200; ++run)
+        {
+            fixedCut->select(selected, scores, 40);
+            EXPECT_EQ(selected, expected);
+        }
+    };
+    std::thread first(selectMany, std::cref(ascending), std::cref(expectedAscending));
+    std::thread second(selectMany, std::cref(descending), std::cref(expectedDescending));
+    first.join();
+    second.join();
+}
+
+TEST_F(TrackTest, ReviewAggregateStatistics)
+{
+    // Weighted by confidence: (3 * 3 + 1 * 1 + (-1) * 2) / 6
+    ReviewAggregate score;
+    score.add(Review("", Rating::Excellent, Confidence::High));
+    score.add(Review("", Rating::Good, Confidence::Low));
+    score.add(Review("", Rating::Bad, Confidence::Medium));
+    EXPECT_EQ(score.count(), 3);
+    EXPECT_EQ(score.weight(), 6);
+    EXPECT_EQ(score.weightedSum(), 8);
+    EXPECT_NEAR(score.mean(), 8.0 / 6.0, 1e-9);
+    EXPECT_NEAR(score.variance(), (3 * 25.0 / 9 + 1 * 1.0 / 9 + 2 * 49.0 / 9) / 6, 1e-9);
+    EXPECT_EQ(score.min(), Rating::Bad);
+    EXPECT_EQ(score.max(), Rating::Excellent);
+    EXPECT_EQ(score.rating(), Rating::VeryGood);
+    EXPECT_EQ(score.scoreKey(), 1334);
+
+    // Negative means round up towards zero
+    const auto negative = scoreOf({Rating::Bad, Rating::VeryBad});
+    EXPECT_EQ(negative.rating(), Rating::Bad);
+    EXPECT_EQ(negative.scoreKey(), -1500);
+
+    // Same rating, the higher mean is selected first
+    const std::vector<ReviewAggregate> scores{scoreOf({Rating::Good, Rating::VeryGood}),
+                                              scoreOf({Rating::VeryGood, Rating::VeryGood}),
+                                              scoreOf({Rating::Excellent, Rating::Good})};
+    auto fixedCut = std::make_shared<SelectionStrategyFixedCut>();
+    std::vector<ArticleId> selected;
+    fixedCut->select(selected, scores, 100);
+    EXPECT_EQ(selected, (std::vector<ArticleId>{1, 2, 0}));
+}
+
+TEST_F(TrackTest, RejectionsCarryReasonCodes)
+{
+    auto track = TrackFactory::createTrack(R"({"trackType": "poster", "trackTopic": "Posters"})"_json);
+    track->reportSink(std::make_shared<ReportSinkNull>());
+
+    nlohmann::json posterJson = {{"articleTitle", "Visualizing Big Data"},
+                                 {"attachedFileUrl", "https://bit.ly/example"},
+                                 {"additionalFileUrl", "https://bit.ly/example2"},
+                                 {"authors", {"Jane Smith"}}};
+    const auto poster = std::make_shared<ArticlePoster>(posterJson);
+    const auto regular = std::make_shared<ArticleRegular>(nlohmann::json{{"articleTitle", "Modern C++"},
+                                                                          {"attachedFileUrl", "https://bit.ly/example"},
+                                                                          {"abstract", "Concepts and ranges."}});
+    const auto invalid = std::make_shared<ArticleRegular>(nlohmann::json{{"articleTitle", "Empty"}});
+
+    // Every submission reports whether it was carried out, and why not
+    EXPECT_EQ(track->handleTrackArticle(poster, OperationType::Create).error(), TrackError::None);
+    EXPECT_EQ(track->handleTrackArticle(poster, OperationType::Create).error(), TrackError::DuplicateArticle);
+    EXPECT_EQ(track->handleTrackArticle(regular, OperationType::Create).error(), TrackError::WrongArticleType);
+    EXPECT_EQ(track->handleTrackArticle(invalid, OperationType::Create).error(), TrackError::InvalidArticle);
+    EXPECT_EQ(track->handleTrackBidding().error(), TrackError::PhaseClosed);
+
+    track->establishState(BiddingStateTrack{});
+    const auto late = track->handleTrackArticle(poster, OperationType::Delete);
+    EXPECT_FALSE(late);
+    EXPECT_EQ(late.error(), TrackError::PhaseClosed);
+    EXPECT_EQ(late.message(), "Cannot handle articles in Bidding state");
+    EXPECT_TRUE(track->handleTrackBidding());
+
+    track->establishState(ReceptionStateTrack{});
+    EXPECT_TRUE(track->handleTrackArticle(poster, OperationType::Delete));
+    EXPECT_EQ(track->handleTrackArticle(poster, OperationType::Update).error(), TrackError::ArticleNotFound);
+    EXPECT_EQ(track->amountArticles(), 0);
+}
+
+TEST_F(TrackTest, BatchSubmissionMatchesSingleSubmissions)
+{
+    auto single = TrackFactory::createTrack(R"({"trackType": "regular", "trackTopic": "Single"})"_json);
+    auto batch = TrackFactory::createTrack(R"({"trackType": "regular", "trackTopic": "Batch"})"_json);
+    single->reportSink(std::make_shared<ReportSinkNull>());
+    batch->reportSink(std::make_shared<ReportSinkNull>());
+
+    // Valid articles, a duplicated title, an invalid article and a poster in the same batch
+    std::vector<std::shared_ptr<Article>> articles;
+    for (const auto& title : {"Article A", "Article B", "Article A", "Article C"})
+    {
+        const nlohmann::json articleJson = {{"articleTitle", title},
+                                            {"attachedFileUrl", "https://bit.ly/example"},
+                                            {"abstract", "Concepts and ranges."}};
+        articles.push_back(std::make_shared<ArticleRegular>(articleJson));
+    }
+    articles.push_back(std::make_shared<ArticleRegular>(nlohmann::json{{"articleTitle", "Empty"}}));
+    const nlohmann::json posterJson = {{"articleTitle", "Poster"},
+                                       {"attachedFileUrl", "https://bit.ly/example"},
+                                       {"additionalFileUrl", "https://bit.ly/example2"}};
+    articles.push_back(std::make_shared<ArticlePoster>(posterJson));
+
+    std::vector<TrackResult> expected;
+    for (const auto& article : articles)
+    {
+        expected.push_back(single->handleTrackArticle(article, OperationType::Create));
+    }
+    const auto results = batch->handleTrackArticles(articles, OperationType::Create);
+    ASSERT_EQ(results.size(), articles.size());
+    for (size_t article = 0; article < articles.size(); ++article)
+    {
+        EXPECT_EQ(results[article].error(), expected[article].error());
+    }
+    EXPECT_EQ(results[2].error(), TrackError::DuplicateArticle);
+    EXPECT_EQ(results[4].error(), TrackError::InvalidArticle);
+    EXPECT_EQ(results[5].error(), TrackError::WrongArticleType);
+    EXPECT_EQ(batch->amountArticles(), 3);
+    EXPECT_EQ(batch->articles()[2]->articleName(), "Article C");
+
+    // Deleting in a batch, then every accepted article is rejected once the phase is closed
+    const std::vector<std::shared_ptr<Article>> removed{articles[0], articles[0]};
+    const auto deletions = batch->handleTrackArticles(removed, OperationType::Delete);
+    EXPECT_TRUE(deletions[0]);
+    EXPECT_EQ(deletions[1].error(), TrackError::ArticleNotFound);
+
+    batch->establishState(BiddingStateTrack{});
+    const auto late = batch->handleTrackArticles(articles, OperationType::Update);
+    EXPECT_EQ(late[0].error(), TrackError::PhaseClosed);
+    EXPECT_EQ(late[4].error(), TrackError::InvalidArticle);
+    EXPECT_EQ(batch->amountArticles(), 2);
+}
+
+TEST_F(TrackTest, ReviewsUpdateScoresAsTheyArrive)
+{
+    auto track = TrackFactory::createTrack(R"({"trackType": "regular", "trackTopic": "Live"})"_json);
+    track->reportSink(std::make_shared<ReportSinkNull>());
+    for (const auto& title : {"Article A", "Article B"})
+    {
+        const nlohmann::json articleJson = {{"articleTitle", title},
+                                            {"attachedFileUrl", "https://bit.ly/example"},
+                                            {"abstract", "Concepts and ranges."}};
+        track->handleTrackArticle(std::make_shared<ArticleRegular>(articleJson), OperationType::Create);
+    }
+
+    // Reviews are only taken during the review phase
+    const Review good("Solid work", Rating::Good, Confidence::High);
+    EXPECT_EQ(track->submitReview(0, good).error(), TrackError::PhaseClosed);
+    EXPECT_TRUE(track->articleScores().empty());
+
+    // Each review updates the score of its article alone
+    track->establishState(ReviewStateTrack{});
+    EXPECT_TRUE(track->submitReview(0, good));
+    ASSERT_EQ(track->articleScores().size(), 2);
+    EXPECT_EQ(track->articleScores()[0].count(), 1);
+    EXPECT_TRUE(track->articleScores()[1].empty());
+
+    EXPECT_TRUE(track->submitReview(0, Review("Needs work", Rating::Bad, Confidence::High)));
+    EXPECT_TRUE(track->submitReview(1, good));
+    EXPECT_EQ(track->articleScores()[0].count(), 2);
+    EXPECT_EQ(track->articleScores()[0].rating(), Rating::Neutral);
+    EXPECT_EQ(track->articleScores()[1].count(), 1);
+    EXPECT_EQ(track->reviewStore().articleReviews(0).size(), 2);
+    EXPECT_EQ(track->submitReview(2, good).error(), TrackError::ArticleNotFound);
+
+    // Without reviewers, running the whole phase keeps the submitted reviews and adds none
+    track->assignmentStrategy(std::make_shared<AssignmentStrategyOptimal>(2));
+    EXPECT_TRUE(track->handleTrackReview());
+    EXPECT_EQ(track->articleScores()[0].count(), 2);
+    EXPECT_EQ(track->articleScores()[1].count(), 1);
+}
+
+TEST_F(TrackTest, ReviewPhaseOnlyCollectsMissingReviews)
+{
+    /**
+     * @brief Optimal assignment counting how many times it runs.
+     */
+    class CountingStrategy : public AssignmentStrategyOptimal
+    {
+      public:
+        using AssignmentStrategyOptimal::AssignmentStrategyOptimal;
+        size_t runs{0}; /**< The number of assignments computed so far. */
+
+        void assign(std::pmr::vector<ReviewAssignment>& assignments, const BidMatrix& bids,
+                    const ConflictMask& conflicts, std::span<const ReviewAssignment> reviewed) override
+        {
+            ++runs;
+            AssignmentStrategyOptimal::assign(assignments, bids, conflicts, reviewed);
+        }
+    };
+
+    auto track = TrackFactory::createTrack(R"({"trackType": "regular", "trackTopic": "Quota"})"_json);
+    track->reportSink(std::make_shared<ReportSinkNull>());
+    for (const auto& name : {"Martin Venturino", "Gabriel Valenzuela", "Ada Lovelace"})
+    {
+        nlohmann::json reviewerJson = {{"name", name},       {"affiliation", "UNC"}, {"email", "chair@tyh.com"},
+                                       {"password", "1234"}, {"isChair", false},     {"isAuthor", false},
+                                       {"isReviewer", true}};
+        track->addReviewer(std::make_shared<Reviewer>(reviewerJson));
+    }
+    for (const auto& title : {"Article A", "Article B", "Article C"})
+    {
+        const nlohmann::json articleJson = {{"articleTitle", title},
+                                            {"attachedFileUrl", "https://bit.ly/example"},
+                                            {"abstract", "Concepts and ranges."}};
+        track->handleTrackArticle(std::make_shared<ArticleRegular>(articleJson), OperationType::Create);
+    }
+
+    // Article A already holds its two reviews and article B one of them
+    track->establishState(ReviewStateTrack{});
+    const Review good("Solid work", Rating::Good, Confidence::High);
+    EXPECT_TRUE(track->submitReview(0, good));
+    EXPECT_TRUE(track->submitReview(0, good));
+    EXPECT_TRUE(track->submitReview(1, good));
+
+    // The phase tops every article up to its quota
+    auto strategy = std::make_shared<CountingStrategy>(2);
+    track->assignmentStrategy(strategy);
+    EXPECT_TRUE(track->handleTrackReview());
+    EXPECT_EQ(strategy->runs, 1);
+    const auto& reviews = track->reviewStore();
+    EXPECT_EQ(reviews.size(), 6);
+    EXPECT_EQ(track->amountReviews(), 3);
+    for (ArticleId article = 0; article < 3; ++article)
+    {
+        EXPECT_EQ(reviews.articleReviews(article).size(), 2);
+        EXPECT_EQ(track->articleScores()[article].count(), 2);
+    }
+    EXPECT_EQ(reviews[reviews.articleReviews(0)[1]].reviewer, ReviewStore::NO_REVIEWER);
+
+    // Article C was reviewed by two different reviewers
+    const auto articleC = reviews.articleReviews(2);
+    EXPECT_NE(reviews[articleC[0]].reviewer, reviews[articleC[1]].reviewer);
+
+    // Once every article is full, running the phase again computes no assignment
+    EXPECT_TRUE(track->handleTrackReview());
+    EXPECT_EQ(strategy->runs, 1);
+    EXPECT_EQ(reviews.size(), 6);
+}
+
+TEST_F(TrackTest, LeaderboardFollowsTheReviews)
+{
+    // Ratings cycling from Bad to Good, with an unreviewed article
+    Leaderboard leaderboard;
+    leaderboard.resize(20);
+    std::vector<ReviewAggregate> scores(20);
+    for (ArticleId article = 0; article < 20; ++article)
+    {
+        if (article != 7)
+        {
+            const Review review("", static_cast<Rating>(article % 3 - 1), Confidence::High);
+            leaderboard.add(article, review);
+            scores[article].add(review);
+        }
+    }
+    EXPECT_EQ(leaderboard.size(), 20);
+    EXPECT_EQ(leaderboard.reviewed(), 19);
+
+    // Counting and ranking by score, ties sharing their rank
+    EXPECT_EQ(leaderboard.atOrAbove(Leaderboard::LOWEST_KEY - 1), 19);
+    EXPECT_EQ(leaderboard.atOrAbove(0), 12);
+    EXPECT_EQ(leaderboard.atOrAbove(1), 6);
+    EXPECT_EQ(leaderboard.atOrAbove(Leaderboard::HIGHEST_KEY + 1), 0);
+    EXPECT_EQ(leaderboard.rank(2), 1);
+    EXPECT_EQ(leaderboard.rank(0), 13);
+    EXPECT_EQ(leaderboard.rank(1), 7);
+    EXPECT_EQ(leaderboard.rank(7), 0);
+
+    // A new review moves its article only
+    leaderboard.add(1, Review("", Rating::Excellent, Confidence::High));
+    EXPECT_EQ(leaderboard[1].count(), 2);
+    EXPECT_EQ(leaderboard.rank(1), 1);
+    EXPECT_EQ(leaderboard.rank(2), 2);
+    EXPECT_EQ(leaderboard.atOrAbove(0), 12);
+    scores[1].add(Review("", Rating::Excellent, Confidence::High));
+
+    // Both strategies select the same articles from the ranking as from the scores
+    std::vector<ArticleId> fromScores;
+    std::vector<ArticleId> fromRanking;
+    SelectionStrategyFixedCut fixedCut;
+    for (const auto threshold : {1, 30, 50, 100})
+    {
+        fixedCut.select(fromScores, scores, threshold);
+        fixedCut.select(fromRanking, leaderboard, threshold);
+        EXPECT_EQ(fromScores, fromRanking);
+    }
+    SelectionStrategyBest best;
+    for (int threshold = -3; threshold <= 3; ++threshold)
+    {
+        best.select(fromScores, scores, threshold);
+        best.select(fromRanking, leaderboard, threshold);
+        EXPECT_EQ(fromScores, fromRanking);
+    }
+
+    // Dropped articles leave the ranking
+    leaderboard.resize(3);
+    EXPECT_EQ(leaderboard.reviewed(), 3);
+    leaderboard.top(10, fromRanking);
+    EXPECT_EQ(fromRanking, (std::vector<ArticleId>{1, 2, 0}));
+}